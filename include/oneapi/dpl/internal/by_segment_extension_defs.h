@@ -83,6 +83,42 @@ oneapi::dpl::__internal::__enable_if_execution_policy<Policy, ::std::pair<Output
 reduce_by_segment(Policy&& policy, InputIterator1 first1, InputIterator1 last1, InputIterator2 first2,
                   OutputIterator1 result1, OutputIterator2 result2, BinaryPred binary_pred, BinaryOperator binary_op);
 
+template <typename Policy, typename InputIterator1, typename InputIterator2, typename OutputIterator1,
+          typename OutputIterator2>
+oneapi::dpl::__internal::__enable_if_execution_policy<Policy, ::std::pair<OutputIterator1, OutputIterator2>>
+reduce_by_key_unsorted(Policy&& policy, InputIterator1 first1, InputIterator1 last1, InputIterator2 first2,
+                       OutputIterator1 result1, OutputIterator2 result2);
+
+template <typename Policy, typename InputIterator1, typename InputIterator2, typename OutputIterator1,
+          typename OutputIterator2, typename BinaryPred>
+oneapi::dpl::__internal::__enable_if_execution_policy<Policy, ::std::pair<OutputIterator1, OutputIterator2>>
+reduce_by_key_unsorted(Policy&& policy, InputIterator1 first1, InputIterator1 last1, InputIterator2 first2,
+                       OutputIterator1 result1, OutputIterator2 result2, BinaryPred binary_pred);
+
+template <typename Policy, typename InputIterator1, typename InputIterator2, typename OutputIterator1,
+          typename OutputIterator2, typename BinaryPred, typename BinaryOperator>
+oneapi::dpl::__internal::__enable_if_execution_policy<Policy, ::std::pair<OutputIterator1, OutputIterator2>>
+reduce_by_key_unsorted(Policy&& policy, InputIterator1 first1, InputIterator1 last1, InputIterator2 first2,
+                       OutputIterator1 result1, OutputIterator2 result2, BinaryPred binary_pred,
+                       BinaryOperator binary_op);
+
+template <typename Policy, typename InputIterator1, typename InputIterator2, typename OutputIterator1,
+          typename OutputIterator2, typename BinaryPred, typename BinaryOperator>
+oneapi::dpl::__internal::__enable_if_execution_policy<Policy, ::std::pair<OutputIterator1, OutputIterator2>>
+reduce_by_key_unsorted(Policy&& policy, InputIterator1 first1, InputIterator1 last1, InputIterator2 first2,
+                       OutputIterator1 result1, OutputIterator2 result2, BinaryPred binary_pred,
+                       BinaryOperator binary_op, ::std::size_t size_hint);
+
+template <typename Policy, typename RandomAccessIterator1, typename RandomAccessIterator2, typename Compare>
+oneapi::dpl::__internal::__enable_if_execution_policy<Policy, void>
+sort_by_segment(Policy&& policy, RandomAccessIterator1 keys_first, RandomAccessIterator1 keys_last,
+                RandomAccessIterator2 offsets_first, RandomAccessIterator2 offsets_last, Compare comp);
+
+template <typename Policy, typename RandomAccessIterator1, typename RandomAccessIterator2>
+oneapi::dpl::__internal::__enable_if_execution_policy<Policy, void>
+sort_by_segment(Policy&& policy, RandomAccessIterator1 keys_first, RandomAccessIterator1 keys_last,
+                RandomAccessIterator2 offsets_first, RandomAccessIterator2 offsets_last);
+
 } // end namespace dpl
 } // end namespace oneapi
 
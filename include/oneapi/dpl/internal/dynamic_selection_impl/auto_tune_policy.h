@@ -11,22 +11,38 @@
 #define _ONEDPL_AUTO_TUNE_POLICY_H
 
 #include <stdexcept>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <functional>
+#include <iomanip>
+#include <istream>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <ostream>
+#include <shared_mutex>
+#include <sstream>
+#include <string>
+#include <typeinfo>
 #include <utility>
 #include <chrono>
+#include <cmath>
+#include <cstdint>
 #include <ratio>
 #include <limits>
 #include <vector>
 #include <type_traits>
 #include <tuple>
-#include <unordered_map>
 #include "oneapi/dpl/internal/dynamic_selection_traits.h"
 #include "oneapi/dpl/internal/dynamic_selection_impl/backend_traits.h"
+#include "oneapi/dpl/internal/dynamic_selection_impl/telemetry.h"
 #if _DS_BACKEND_SYCL != 0
 #    include "oneapi/dpl/internal/dynamic_selection_impl/sycl_backend.h"
 #endif
+#if _DS_BACKEND_TBB != 0
+#    include "oneapi/dpl/internal/dynamic_selection_impl/tbb_backend.h"
+#endif
 
 namespace oneapi
 {
@@ -35,8 +51,66 @@ namespace dpl
 namespace experimental
 {
 
+// Maps a key argument of auto_tune_policy to the value the tuning is keyed by.
+// Arithmetic arguments are treated as problem sizes and grouped into log2 buckets,
+// so that the sizes of the same order share one tuner; specialize it to group the values differently.
+template <typename T, typename = void>
+struct auto_tune_key_projection
+{
+    T
+    operator()(const T& v) const
+    {
+        return v;
+    }
+};
+
+template <typename T>
+struct auto_tune_key_projection<T, std::enable_if_t<std::is_arithmetic_v<T> && !std::is_same_v<T, bool>>>
+{
+    std::int64_t
+    operator()(T v) const
+    {
+        const bool negative = v < T(0);
+        std::int64_t bucket = 0;
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            // v = f * 2^e with 0.5 <= |f| < 1, so e is the bit width of the integral part of the magnitude;
+            // fractional magnitudes, infinities and NaN fall into the bucket 0
+            int e = 0;
+            if (std::isfinite(v))
+                std::frexp(v, &e);
+            bucket = std::max(e, 0);
+        }
+        else
+        {
+            // the magnitude is negated in the unsigned type, which is defined for the minimum value as well
+            using unsigned_t = std::make_unsigned_t<T>;
+            unsigned_t m = negative ? unsigned_t(unsigned_t(0) - unsigned_t(v)) : unsigned_t(v);
+            for (; m != 0; m >>= 1)
+                ++bucket;
+        }
+        return negative ? -bucket : bucket;
+    }
+};
+
+namespace internal
+{
+template <typename T, typename = void>
+struct is_output_streamable : std::false_type
+{
+};
+
+template <typename T>
+struct is_output_streamable<T, std::void_t<decltype(std::declval<std::ostream&>() << std::declval<const T&>())>>
+    : std::true_type
+{
+};
+} // namespace internal
+
 #if _DS_BACKEND_SYCL != 0
 template <typename Backend = sycl_backend, typename... KeyArgs>
+#elif _DS_BACKEND_TBB != 0
+template <typename Backend = tbb_backend, typename... KeyArgs>
 #else
 template <typename Backend, typename... KeyArgs>
 #endif
@@ -50,105 +124,247 @@ class auto_tune_policy
     using timing_t = uint64_t;
 
     using report_clock_type = std::chrono::steady_clock;
-    using report_duration = std::chrono::milliseconds;
+    using report_duration = std::chrono::nanoseconds;
+    using resample_duration = std::chrono::milliseconds;
 
     static constexpr timing_t never_resample = 0;
     static constexpr size_type use_best_resource = ~size_type(0);
 
+    // weight of a new timing in the moving averages
+    static constexpr double ewma_alpha = 0.25;
+    // half-width of the confidence interval of a timing, in standard deviations
+    static constexpr double confidence_z = 2.0;
+    // at most one of that many selections explores a resource other than the best one
+    static constexpr uint64_t exploration_period = 16;
+
     struct resource_with_index_t
     {
         wrapped_resource_t r_;
         size_type index_ = 0;
     };
 
+    // Exponentially weighted moving average and variance of the timings in nanoseconds
     struct time_data_t
     {
         uint64_t num_timings_ = 0;
-        timing_t value_ = 0;
+        double mean_ = 0;
+        double variance_ = 0;
+        report_clock_type::time_point last_;
+
+        void
+        add(double t, report_clock_type::time_point now)
+        {
+            if (num_timings_ == 0)
+            {
+                mean_ = t;
+                variance_ = 0;
+            }
+            else
+            {
+                const double diff = t - mean_;
+                const double incr = ewma_alpha * diff;
+                mean_ += incr;
+                variance_ = (1 - ewma_alpha) * (variance_ + diff * incr);
+            }
+            ++num_timings_;
+            last_ = now;
+        }
+
+        double
+        lower_bound() const
+        {
+            return mean_ - confidence_z * std::sqrt(variance_);
+        }
+
+        double
+        upper_bound() const
+        {
+            return mean_ + confidence_z * std::sqrt(variance_);
+        }
     };
 
+    // Timing statistics of a resource saved by export_tuning
+    struct saved_timing_t
+    {
+        size_type index_ = 0;
+        uint64_t num_timings_ = 0;
+        double mean_ = 0;
+        double variance_ = 0;
+    };
+
+    // The selections of the best resource do not lock: only the explorations and the timings take the mutex
     struct tuner_t
     {
         std::mutex m_;
 
-        report_clock_type::time_point t0_;
-
-        timing_t best_timing_ = std::numeric_limits<timing_t>::max();
-        resource_with_index_t best_resource_;
+        const std::vector<resource_with_index_t> resources_;
+        // written under the mutex, read without it
+        std::atomic<size_type> best_index_{0};
 
         const size_type max_resource_to_profile_;
-        uint64_t next_resource_to_profile_ = 0; // as index in resources
+        std::atomic<uint64_t> next_resource_to_profile_{0}; // as index in resources
+        std::atomic<uint64_t> selections_{0};
+
+        // the 1st timing of each resource is not counted to cover for JIT compilation
+        std::vector<bool> warmed_up_;
+        std::vector<time_data_t> time_by_index_;
 
-        using time_by_index_t = std::unordered_map<size_type, time_data_t>;
-        time_by_index_t time_by_index_;
+        size_type next_resource_to_explore_ = 0;
 
         timing_t resample_time_ = 0;
 
-        tuner_t(resource_with_index_t br, size_type resources_size, timing_t rt)
-            : t0_(report_clock_type::now()), best_resource_(br), max_resource_to_profile_(resources_size),
-              resample_time_(rt)
+        // identifies the key across processes, empty if the key arguments cannot be written to a stream
+        const std::string stable_key_;
+        // false for a function passed as a pointer, whose address changes from one process to another
+        const bool persistent_;
+
+        // telemetry
+        std::atomic<uint64_t> profiling_selections_{0};
+        uint64_t best_resource_changes_ = 0;
+        std::vector<latency_histogram_t> latency_;
+
+        tuner_t(const std::vector<resource_with_index_t>& resources, timing_t rt, std::string stable_key,
+                bool persistent)
+            : resources_(resources), max_resource_to_profile_(resources.size()), warmed_up_(resources.size(), false),
+              time_by_index_(resources.size()), resample_time_(rt), stable_key_(std::move(stable_key)),
+              persistent_(persistent), latency_(resources.size())
         {
         }
 
+        // called before the tuner is shared; the saved timings replace the profiling phase,
+        // and the exploration detects the drift of the timings as usual
+        void
+        restore(const std::vector<saved_timing_t>& saved)
+        {
+            const auto now = report_clock_type::now();
+            size_type best_index = use_best_resource;
+            for (const saved_timing_t& st : saved)
+            {
+                time_data_t& td = time_by_index_[st.index_];
+                td.num_timings_ = st.num_timings_;
+                td.mean_ = st.mean_;
+                td.variance_ = st.variance_;
+                td.last_ = now;
+                if (best_index == use_best_resource || td.mean_ < time_by_index_[best_index].mean_)
+                    best_index = st.index_;
+            }
+            if (best_index != use_best_resource)
+            {
+                best_index_.store(best_index, std::memory_order_relaxed);
+                next_resource_to_profile_.store(2 * max_resource_to_profile_, std::memory_order_relaxed);
+            }
+        }
+
+        std::vector<saved_timing_t>
+        save()
+        {
+            std::lock_guard<std::mutex> l(m_);
+            std::vector<saved_timing_t> saved;
+            for (size_type i = 0; i < max_resource_to_profile_; ++i)
+            {
+                const time_data_t& td = time_by_index_[i];
+                if (td.num_timings_ != 0)
+                    saved.push_back(saved_timing_t{i, td.num_timings_, td.mean_, td.variance_});
+            }
+            return saved;
+        }
+
+        resource_with_index_t
+        best_resource() const
+        {
+            return resources_[best_index_.load(std::memory_order_relaxed)];
+        }
+
         size_type
         get_resource_to_profile()
         {
-            std::lock_guard<std::mutex> l(m_);
-            if (next_resource_to_profile_ < 2 * max_resource_to_profile_)
+            if (next_resource_to_profile_.load(std::memory_order_relaxed) < 2 * max_resource_to_profile_)
             {
                 // do everything twice
-                return next_resource_to_profile_++ % max_resource_to_profile_;
+                const uint64_t next = next_resource_to_profile_.fetch_add(1, std::memory_order_relaxed);
+                if (next < 2 * max_resource_to_profile_)
+                    return next % max_resource_to_profile_;
             }
-            else if (resample_time_ == never_resample)
+            if ((selections_.fetch_add(1, std::memory_order_relaxed) + 1) % exploration_period != 0)
             {
                 return use_best_resource;
             }
-            else
+
+            std::lock_guard<std::mutex> l(m_);
+            const size_type best_index = best_index_.load(std::memory_order_relaxed);
+            const time_data_t& best = time_by_index_[best_index];
+            // without any timing there is nothing to compare with
+            if (best.num_timings_ == 0)
             {
-                const auto now = report_clock_type::now();
-                const auto ms = std::chrono::duration_cast<report_duration>(now - t0_).count();
-                if (ms < resample_time_)
-                {
-                    return use_best_resource;
-                }
-                else
+                return use_best_resource;
+            }
+
+            // explore a resource that may be better than the best one according to the confidence intervals
+            // of their timings, or that has not been timed for the resample time
+            const auto now = report_clock_type::now();
+            for (size_type i = 0; i < max_resource_to_profile_; ++i)
+            {
+                const size_type index = (next_resource_to_explore_ + i) % max_resource_to_profile_;
+                if (index == best_index)
+                    continue;
+                const time_data_t& td = time_by_index_[index];
+                const bool uncertain = td.num_timings_ == 0 || td.lower_bound() < best.upper_bound();
+                const bool stale = resample_time_ != never_resample &&
+                                   std::chrono::duration_cast<resample_duration>(now - td.last_).count() >=
+                                       static_cast<std::int64_t>(resample_time_);
+                if (uncertain || stale)
                 {
-                    t0_ = now;
-                    next_resource_to_profile_ = 0;
-                    return next_resource_to_profile_++;
+                    next_resource_to_explore_ = index + 1;
+                    return index;
                 }
             }
+            return use_best_resource;
         }
 
-        // called to add new profile info
-        void
-        add_new_timing(resource_with_index_t r, timing_t t)
+        // called to add new profile info; returns true if the best resource changes
+        bool
+        add_new_timing(resource_with_index_t r, report_duration t)
         {
             auto index = r.index_;
-            timing_t new_value = t;
 
             std::lock_guard<std::mutex> l(m_);
 
-            // ignore the 1st timing to cover for JIT compilation
-            auto emplace_res = time_by_index_.try_emplace(index, time_data_t{0, std::numeric_limits<timing_t>::max()});
+            ++latency_[index][internal::latency_bucket(t.count())];
+            if (!warmed_up_[index])
+            {
+                warmed_up_[index] = true;
+                return false;
+            }
+            time_by_index_[index].add(static_cast<double>(t.count()), report_clock_type::now());
 
-            // emplace_res is std::pair<time_by_index_t::iterator, bool> where
-            //  - emplace_res.first iterate inserted or existing element;
-            //  - emplace_res.second is true if new element inserted, false if element with such key already existed.
-            if (!emplace_res.second)
+            // the timings of the best resource may grow as well, so look for the minimum again
+            const size_type old_best_index = best_index_.load(std::memory_order_relaxed);
+            size_type best_index = old_best_index;
+            for (size_type i = 0; i < max_resource_to_profile_; ++i)
             {
-                // get reference to time_data_t from already existing element
-                auto& td = emplace_res.first->second;
-                auto n = td.num_timings_;
-                new_value = (n * td.value_ + t) / (n + 1);
-                td.num_timings_ = n + 1;
-                td.value_ = new_value;
+                const time_data_t& td = time_by_index_[i];
+                if (td.num_timings_ != 0 && (time_by_index_[best_index].num_timings_ == 0 ||
+                                             td.mean_ < time_by_index_[best_index].mean_))
+                {
+                    best_index = i;
+                }
             }
-            if (new_value < best_timing_)
+            if (best_index != old_best_index)
             {
-                best_timing_ = new_value;
-                best_resource_ = r;
+                best_index_.store(best_index, std::memory_order_relaxed);
+                ++best_resource_changes_;
+                return true;
             }
+            return false;
+        }
+
+        key_telemetry_t
+        get_telemetry()
+        {
+            std::lock_guard<std::mutex> l(m_);
+            return key_telemetry_t{stable_key_, best_index_.load(std::memory_order_relaxed),
+                                   profiling_selections_.load(std::memory_order_relaxed), best_resource_changes_,
+                                   latency_};
         }
     };
 
@@ -177,10 +393,27 @@ class auto_tune_policy
             return policy_;
         };
 
+        // The task time is taken as a std::chrono::duration of any units, which are converted here,
+        // so that a timing cannot be reported in the wrong units
+        template <typename Rep, typename Period>
+        void
+        report(const execution_info::task_time_t&, std::chrono::duration<Rep, Period> v) const
+        {
+            const report_duration t = std::chrono::duration_cast<report_duration>(v);
+            internal::telemetry_recorder_t& telemetry = policy_.state_->telemetry_;
+            telemetry.on_task_time(resource_.index_, t.count(), tuner_->stable_key_);
+            if (tuner_->add_new_timing(resource_, t))
+            {
+                telemetry.notify(telemetry_event_kind_t::best_resource_change,
+                                 tuner_->best_index_.load(std::memory_order_relaxed), tuner_->stable_key_);
+            }
+        }
+
+        template <typename T>
         void
-        report(const execution_info::task_time_t&, report_duration v) const
+        report(const execution_info::task_time_t&, const T&) const
         {
-            tuner_->add_new_timing(resource_, v.count());
+            static_assert(sizeof(T) == 0, "the task time must be reported as a std::chrono::duration");
         }
     };
 
@@ -232,17 +465,20 @@ class auto_tune_policy
         }
         if (state_)
         {
-            std::lock_guard<std::mutex> l(state_->m_);
-            auto k = make_task_key(std::forward<Function>(f), std::forward<Args>(args)...);
-            auto t = state_->tuner_by_key_[k];
+            auto t = get_tuner(std::forward<Function>(f), std::forward<Args>(args)...);
             auto index = t->get_resource_to_profile();
             if (index == use_best_resource)
             {
-                return selection_type{*this, t->best_resource_, t};
+                auto r = t->best_resource();
+                state_->telemetry_.on_selection(r.index_, t->stable_key_);
+                return selection_type{*this, r, t};
             }
             else
             {
                 auto r = state_->resources_with_index_[index];
+                t->profiling_selections_.fetch_add(1, std::memory_order_relaxed);
+                state_->telemetry_.notify(telemetry_event_kind_t::profiling, index, t->stable_key_);
+                state_->telemetry_.on_selection(index, t->stable_key_);
                 return selection_type{*this, r, t};
             }
         }
@@ -293,14 +529,144 @@ class auto_tune_policy
         }
     }
 
+    // The resource counters are updated by select and by the reported task times, the key entries
+    // are the ones of the tuners; the callback may be set at any time
+    policy_telemetry_t
+    get_telemetry() const
+    {
+        if (!state_)
+            throw std::logic_error("get_telemetry called before initialization");
+
+        policy_telemetry_t telemetry;
+        telemetry.resources = state_->telemetry_.snapshot();
+        for (tuner_shard_t& shard : state_->tuner_shards_)
+        {
+            std::shared_lock<std::shared_mutex> l(shard.m_);
+            for (auto& [k, t] : shard.tuner_by_key_)
+                telemetry.keys.push_back(t->get_telemetry());
+        }
+        return telemetry;
+    }
+
+    void
+    set_telemetry_callback(std::function<void(const telemetry_event_t&)> callback)
+    {
+        if (!state_)
+            throw std::logic_error("set_telemetry_callback called before initialization");
+        state_->telemetry_.set_callback(std::move(callback));
+    }
+
+    // Writes the timings learned for each key but those of the functions passed as pointers, with the resources
+    // given by their descriptors, together with the imported timings of the keys not selected in this process
+    void
+    export_tuning(std::ostream& os) const
+    {
+        static_assert(stable_keys_v, "the key arguments of auto_tune_policy must be writable to std::ostream");
+        if (!state_)
+            throw std::logic_error("export_tuning called before initialization");
+
+        std::map<std::string, std::vector<saved_timing_t>> tuning;
+        {
+            std::lock_guard<std::mutex> l(state_->imported_m_);
+            tuning = state_->imported_;
+        }
+        for (tuner_shard_t& shard : state_->tuner_shards_)
+        {
+            std::shared_lock<std::shared_mutex> l(shard.m_);
+            for (auto& [k, t] : shard.tuner_by_key_)
+            {
+                if (!t->persistent_)
+                    continue;
+                auto saved = t->save();
+                if (!saved.empty())
+                    tuning[t->stable_key_] = std::move(saved);
+            }
+        }
+
+        const auto flags = os.flags();
+        const auto precision = os.precision(std::numeric_limits<double>::max_digits10);
+        os << tuning.size() << '\n';
+        for (const auto& [key, saved] : tuning)
+        {
+            os << key.size() << ' ' << key << ' ' << saved.size() << '\n';
+            for (const saved_timing_t& st : saved)
+            {
+                const std::string& descriptor = state_->descriptors_[st.index_];
+                os << descriptor.size() << ' ' << descriptor << ' ' << st.num_timings_ << ' ' << st.mean_ << ' '
+                   << st.variance_ << '\n';
+            }
+        }
+        os.precision(precision);
+        os.flags(flags);
+    }
+
+    // Reads the timings written by export_tuning; the keys selected afterwards start with them instead of
+    // profiling. The timings of the resources absent from this policy are ignored. On a parse error
+    // the failbit of the stream is set and nothing is imported.
+    void
+    import_tuning(std::istream& is)
+    {
+        static_assert(stable_keys_v, "the key arguments of auto_tune_policy must be writable to std::ostream");
+        if (!state_)
+            throw std::logic_error("import_tuning called before initialization");
+
+        std::map<std::string, std::vector<saved_timing_t>> tuning;
+        std::size_t num_keys = 0;
+        is >> num_keys;
+        for (std::size_t i = 0; is && i < num_keys; ++i)
+        {
+            std::string key;
+            std::size_t num_saved = 0;
+            read_sized_string(is, key);
+            is >> num_saved;
+            std::vector<saved_timing_t> saved;
+            for (std::size_t j = 0; is && j < num_saved; ++j)
+            {
+                std::string descriptor;
+                saved_timing_t st;
+                read_sized_string(is, descriptor);
+                is >> st.num_timings_ >> st.mean_ >> st.variance_;
+                auto it = std::find(state_->descriptors_.begin(), state_->descriptors_.end(), descriptor);
+                if (it != state_->descriptors_.end())
+                {
+                    st.index_ = it - state_->descriptors_.begin();
+                    saved.push_back(st);
+                }
+            }
+            if (!saved.empty())
+                tuning[std::move(key)] = std::move(saved);
+        }
+        if (!is)
+            return;
+
+        std::lock_guard<std::mutex> l(state_->imported_m_);
+        for (auto& [key, saved] : tuning)
+            state_->imported_[key] = std::move(saved);
+    }
+
   private:
     //
     // types
     //
 
-    using task_key_t = std::tuple<void*, KeyArgs...>;
+    using task_key_t = std::tuple<void*, decltype(auto_tune_key_projection<KeyArgs>{}(std::declval<KeyArgs>()))...>;
     using tuner_by_key_t = std::map<task_key_t, std::shared_ptr<tuner_t>>;
 
+    static constexpr bool stable_keys_v =
+        (internal::is_output_streamable<decltype(auto_tune_key_projection<KeyArgs>{}(
+             std::declval<KeyArgs>()))>::value &&
+         ...);
+
+    // the tuners are distributed over the shards by the address of the function, so that
+    // the selections for different functions do not contend, and the lookups take a shared lock
+    static constexpr std::size_t num_tuner_shards = 16;
+
+    struct tuner_shard_t
+    {
+        std::shared_mutex m_;
+        tuner_by_key_t tuner_by_key_;
+    };
+
     //
     // member variables
     //
@@ -309,9 +675,16 @@ class auto_tune_policy
 
     struct state_t
     {
-        std::mutex m_;
         std::vector<resource_with_index_t> resources_with_index_;
-        tuner_by_key_t tuner_by_key_;
+        // stable names of the resources, by index
+        std::vector<std::string> descriptors_;
+        std::array<tuner_shard_t, num_tuner_shards> tuner_shards_;
+
+        // timings imported for the keys that have no tuner yet
+        std::mutex imported_m_;
+        std::map<std::string, std::vector<saved_timing_t>> imported_;
+
+        internal::telemetry_recorder_t telemetry_;
     };
 
     std::shared_ptr<Backend> backend_;
@@ -330,20 +703,99 @@ class auto_tune_policy
         {
             state_->resources_with_index_.push_back(resource_with_index_t{u[i], i});
         }
+        state_->telemetry_.initialize(u.size());
+
+        // the resources with the same description are told apart by their order
+        std::map<std::string, size_type> occurrences;
+        for (size_type i = 0; i < u.size(); ++i)
+        {
+            std::string d;
+            if constexpr (backend_traits::resource_descriptor_v<Backend>)
+                d = backend_->get_resource_descriptor(u[i]);
+            else
+                d = "resource";
+            const size_type n = occurrences[d]++;
+            state_->descriptors_.push_back(d + "#" + std::to_string(n));
+        }
+    }
+
+    static void
+    read_sized_string(std::istream& is, std::string& str)
+    {
+        std::size_t size = 0;
+        if (is >> size && is.get() == ' ')
+        {
+            str.resize(size);
+            is.read(str.data(), size);
+        }
+        else
+        {
+            is.setstate(std::ios_base::failbit);
+        }
     }
 
+    // the type of the function and the projected key arguments, which are the same in another process
+    // running the same program; the functions of the same pointer type are told apart by their addresses,
+    // which only holds within the process, so such keys are neither exported nor imported
     template <typename Function, typename... Args>
-    task_key_t
-    make_task_key(Function&& f, Args&&... args)
+    static std::string
+    make_stable_key(const Function& f, Args&&... args)
     {
-        // called under lock
-        task_key_t k = std::make_tuple(static_cast<void*>(&f), std::forward<Args>(args)...);
-        if (state_->tuner_by_key_.count(k) == 0)
+        if constexpr (stable_keys_v)
         {
-            state_->tuner_by_key_[k] = std::make_shared<tuner_t>(state_->resources_with_index_[0],
-                                                                 state_->resources_with_index_.size(), resample_time_);
+            std::ostringstream os;
+            os << typeid(std::decay_t<Function>).name();
+            if constexpr (std::is_pointer_v<std::decay_t<Function>>)
+            {
+                const auto address = reinterpret_cast<std::uintptr_t>(static_cast<std::decay_t<Function>>(f));
+                os << '@' << std::hex << address << std::dec;
+            }
+            ((os << ' ' << auto_tune_key_projection<KeyArgs>{}(args)), ...);
+            return os.str();
+        }
+        else
+        {
+            return std::string{};
+        }
+    }
+
+    template <typename Function, typename... Args>
+    std::shared_ptr<tuner_t>
+    get_tuner(Function&& f, Args&&... args)
+    {
+        // a function pointer is identified by the function rather than by the variable holding it
+        void* fp = nullptr;
+        if constexpr (std::is_pointer_v<std::decay_t<Function>>)
+            fp = reinterpret_cast<void*>(static_cast<std::decay_t<Function>>(f));
+        else
+            fp = static_cast<void*>(&f);
+        task_key_t k = std::make_tuple(fp, auto_tune_key_projection<KeyArgs>{}(args)...);
+        tuner_shard_t& shard = state_->tuner_shards_[std::hash<void*>{}(fp) % num_tuner_shards];
+        {
+            std::shared_lock<std::shared_mutex> l(shard.m_);
+            auto it = shard.tuner_by_key_.find(k);
+            if (it != shard.tuner_by_key_.end())
+                return it->second;
+        }
+        std::unique_lock<std::shared_mutex> l(shard.m_);
+        auto& t = shard.tuner_by_key_[k];
+        if (!t)
+        {
+            constexpr bool persistent = !std::is_pointer_v<std::decay_t<Function>>;
+            std::string stable_key = make_stable_key(f, args...);
+            t = std::make_shared<tuner_t>(state_->resources_with_index_, resample_time_, stable_key, persistent);
+            if (!persistent)
+                return t;
+
+            std::lock_guard<std::mutex> il(state_->imported_m_);
+            auto it = state_->imported_.find(stable_key);
+            if (it != state_->imported_.end())
+            {
+                t->restore(it->second);
+                state_->imported_.erase(it);
+            }
         }
-        return k;
+        return t;
     }
 };
 
@@ -34,6 +34,22 @@ struct has_lazy_report : decltype(has_lazy_report_impl<Backend>(0))
 {
 };
 
+template <typename Backend>
+auto
+has_resource_descriptor_impl(...) -> std::false_type;
+
+template <typename Backend>
+auto
+has_resource_descriptor_impl(int)
+    -> decltype(std::declval<Backend>().get_resource_descriptor(
+                    std::declval<const typename Backend::execution_resource_t&>()),
+                std::true_type{});
+
+template <typename Backend>
+struct has_resource_descriptor : decltype(has_resource_descriptor_impl<Backend>(0))
+{
+};
+
 } //namespace internal
 
 namespace backend_traits
@@ -46,6 +62,15 @@ struct lazy_report_value
 template <typename S>
 inline constexpr bool lazy_report_v = lazy_report_value<S>::value;
 
+// a backend may describe its resources by strings that stay the same across processes
+template <typename S>
+struct resource_descriptor_value
+{
+    static constexpr bool value = ::oneapi::dpl::experimental::internal::has_resource_descriptor<S>::value;
+};
+template <typename S>
+inline constexpr bool resource_descriptor_v = resource_descriptor_value<S>::value;
+
 } //namespace backend_traits
 
 } // namespace experimental
@@ -0,0 +1,499 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _ONEDPL_DEADLINE_POLICY_H
+#define _ONEDPL_DEADLINE_POLICY_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "oneapi/dpl/internal/dynamic_selection_traits.h"
+#include "oneapi/dpl/internal/dynamic_selection_impl/backend_traits.h"
+#include "oneapi/dpl/internal/dynamic_selection_impl/telemetry.h"
+#if _DS_BACKEND_SYCL != 0
+#    include "oneapi/dpl/internal/dynamic_selection_impl/sycl_backend.h"
+#endif
+#if _DS_BACKEND_TBB != 0
+#    include "oneapi/dpl/internal/dynamic_selection_impl/tbb_backend.h"
+#endif
+
+namespace oneapi
+{
+namespace dpl
+{
+namespace experimental
+{
+
+// The urgency of a task, passed among the arguments of select or submit
+enum class task_priority_t
+{
+    low,    // deferred while the resources are busy with other low priority tasks
+    normal, // the default
+    high    // runs in the capacity held back from the low priority tasks
+};
+
+// The time by which a task should complete; a task with a deadline has a high priority
+struct task_deadline_t
+{
+    std::chrono::steady_clock::time_point time_point;
+
+    task_deadline_t(std::chrono::steady_clock::time_point t) : time_point(t) {}
+
+    // a deadline relative to the current time
+    template <typename Rep, typename Period>
+    task_deadline_t(std::chrono::duration<Rep, Period> d) : time_point(std::chrono::steady_clock::now() + d)
+    {
+    }
+};
+
+// Selects the resource predicted to complete the task first, from the reported task times and the work
+// submitted and not completed on each resource. Low priority tasks are kept to a limited number per resource,
+// which holds back the rest of the capacity for the other tasks; while all the resources are at the limit,
+// the selection of a low priority task waits for one of them to complete. A high priority task, or a task
+// with a deadline, runs in the held back capacity, so its completion is predicted without the pending
+// low priority work.
+#if _DS_BACKEND_SYCL != 0
+template <typename Backend = sycl_backend>
+#elif _DS_BACKEND_TBB != 0
+template <typename Backend = tbb_backend>
+#else
+template <typename Backend>
+#endif
+class deadline_policy
+{
+    using backend_t = Backend;
+    using execution_resource_t = typename backend_t::execution_resource_t;
+    using wrapped_resource_t = execution_resource_t;
+    using report_duration = std::chrono::nanoseconds;
+
+    // weight of a new task time in the moving average
+    static constexpr double ewma_alpha = 0.25;
+    // period of checking the completions while a low priority selection waits
+    static constexpr std::chrono::microseconds low_priority_poll{100};
+
+    struct resource_t
+    {
+        execution_resource_t e_;
+        // moving average of the task times in nanoseconds, 0 until measured
+        std::atomic<std::int64_t> task_time_{0};
+        // predicted nanoseconds of the submitted and not completed tasks, and of the low priority ones among them
+        std::atomic<std::int64_t> pending_time_{0};
+        std::atomic<std::int64_t> low_pending_time_{0};
+        std::atomic<int> in_flight_{0};
+        // the low priority selections holding a slot, from the selection to the completion of their tasks,
+        // or to the destruction of the selections that are not submitted
+        std::atomic<int> low_in_flight_{0};
+
+        resource_t(execution_resource_t e) : e_(std::move(e)) {}
+    };
+
+    struct state_t
+    {
+        std::vector<std::unique_ptr<resource_t>> resources_;
+        int low_priority_limit_ = 1;
+        std::atomic<std::uint64_t> missed_deadlines_{0};
+        std::mutex m_;
+        std::condition_variable low_priority_cv_;
+        internal::telemetry_recorder_t telemetry_;
+    };
+
+    // A slot taken by a low priority selection, shared by its copies. It is released when the completion of
+    // the task is reported, or when the last copy is destroyed, so that a selection that is never submitted,
+    // or whose completion is not reported by the backend, does not keep the slot.
+    class low_priority_slot_t
+    {
+        std::shared_ptr<state_t> state_;
+        resource_t* resource_;
+        std::atomic<bool> released_{false};
+
+      public:
+        low_priority_slot_t(std::shared_ptr<state_t> state, resource_t* r) : state_(std::move(state)), resource_(r)
+        {
+        }
+
+        low_priority_slot_t(const low_priority_slot_t&) = delete;
+        low_priority_slot_t&
+        operator=(const low_priority_slot_t&) = delete;
+
+        ~low_priority_slot_t() { release(); }
+
+        void
+        release()
+        {
+            if (!released_.exchange(true, std::memory_order_relaxed))
+            {
+                resource_->low_in_flight_.fetch_sub(1, std::memory_order_release);
+                state_->low_priority_cv_.notify_all();
+            }
+        }
+    };
+
+    class deadline_selection_type
+    {
+        using policy_t = deadline_policy<Backend>;
+        policy_t policy_;
+        resource_t* resource_;
+        std::size_t index_;
+        task_priority_t priority_;
+        // the task time predicted at the selection, added to the pending time of the resource until completion
+        std::int64_t predicted_time_;
+        // held by the low priority selections only
+        std::shared_ptr<low_priority_slot_t> low_priority_slot_;
+
+      public:
+        deadline_selection_type(const policy_t& p, resource_t* r, std::size_t index, task_priority_t priority,
+                                std::int64_t predicted_time)
+            : policy_(p), resource_(r), index_(index), priority_(priority), predicted_time_(predicted_time)
+        {
+            if (priority_ == task_priority_t::low)
+                low_priority_slot_ = std::make_shared<low_priority_slot_t>(policy_.state_, resource_);
+        }
+
+        auto
+        unwrap()
+        {
+            return ::oneapi::dpl::experimental::unwrap(resource_->e_);
+        }
+
+        policy_t
+        get_policy()
+        {
+            return policy_;
+        };
+
+        task_priority_t
+        priority() const
+        {
+            return priority_;
+        }
+
+        void
+        report(const execution_info::task_submission_t&) const
+        {
+            resource_->pending_time_.fetch_add(predicted_time_, std::memory_order_relaxed);
+            resource_->in_flight_.fetch_add(1, std::memory_order_relaxed);
+            if (priority_ == task_priority_t::low)
+                resource_->low_pending_time_.fetch_add(predicted_time_, std::memory_order_relaxed);
+        }
+
+        // releases the slot taken by a low priority selection
+        void
+        report(const execution_info::task_completion_t&) const
+        {
+            resource_->pending_time_.fetch_sub(predicted_time_, std::memory_order_relaxed);
+            resource_->in_flight_.fetch_sub(1, std::memory_order_relaxed);
+            if (priority_ == task_priority_t::low)
+            {
+                resource_->low_pending_time_.fetch_sub(predicted_time_, std::memory_order_relaxed);
+                low_priority_slot_->release();
+            }
+        }
+
+        void
+        report(const execution_info::task_time_t&, report_duration v) const
+        {
+            policy_.add_task_time(index_, v);
+        }
+    };
+
+  public:
+    // Needed by Policy Traits
+    using resource_type = decltype(unwrap(std::declval<wrapped_resource_t>()));
+    using wait_type = typename Backend::wait_type;
+    using selection_type = deadline_selection_type;
+
+    deadline_policy(deferred_initialization_t) {}
+
+    deadline_policy(int low_priority_limit = 1) { initialize(low_priority_limit); }
+
+    deadline_policy(const std::vector<resource_type>& u, int low_priority_limit = 1)
+    {
+        initialize(u, low_priority_limit);
+    }
+
+    void
+    initialize(int low_priority_limit = 1)
+    {
+        if (!state_)
+        {
+            backend_ = std::make_shared<backend_t>();
+            initialize_impl(low_priority_limit);
+        }
+    }
+
+    void
+    initialize(const std::vector<resource_type>& u, int low_priority_limit = 1)
+    {
+        if (!state_)
+        {
+            backend_ = std::make_shared<backend_t>(u);
+            initialize_impl(low_priority_limit);
+        }
+    }
+
+    // The priority and the deadline are taken from the arguments of type task_priority_t and task_deadline_t,
+    // the other arguments are ignored
+    template <typename... Args>
+    selection_type
+    select(Args&&... args)
+    {
+        if (!state_)
+        {
+            throw std::logic_error("select called before initialization");
+        }
+
+        task_priority_t priority = task_priority_t::normal;
+        const task_deadline_t* deadline = nullptr;
+        (get_urgency(args, priority, deadline), ...);
+
+        prediction_t prediction;
+        while (true)
+        {
+            if constexpr (backend_traits::lazy_report_v<Backend>)
+            {
+                backend_->lazy_report();
+            }
+            if (find_first_completion(priority, prediction))
+            {
+                // the slot of a low priority task is taken by the selection rather than by the submission,
+                // so that the concurrent selections cannot exceed the limit; another one may have taken
+                // the last slot of the resource since it was found. The selection owns the slot from here.
+                if (priority != task_priority_t::low ||
+                    try_reserve_low_priority_slot(*state_->resources_[prediction.index_]))
+                    break;
+                continue;
+            }
+            std::unique_lock<std::mutex> l(state_->m_);
+            state_->low_priority_cv_.wait_for(l, low_priority_poll);
+        }
+        if (deadline &&
+            std::chrono::steady_clock::now() + report_duration(prediction.completion_) > deadline->time_point)
+        {
+            state_->missed_deadlines_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        const std::size_t index = prediction.index_;
+        selection_type selection{*this, state_->resources_[index].get(), index, priority, prediction.task_time_};
+        state_->telemetry_.on_selection(index);
+        return selection;
+    }
+
+    template <typename Function, typename... Args>
+    auto
+    submit(selection_type e, Function&& f, Args&&... args)
+    {
+        if (backend_)
+        {
+            return backend_->submit(e, std::forward<Function>(f), std::forward<Args>(args)...);
+        }
+        else
+        {
+            throw std::logic_error("submit called before initialization");
+        }
+    }
+
+    auto
+    get_resources()
+    {
+        if (backend_)
+        {
+            return backend_->get_resources();
+        }
+        else
+        {
+            throw std::logic_error("get_resources called before initialization");
+        }
+    }
+
+    auto
+    get_submission_group()
+    {
+        if (backend_)
+        {
+            return backend_->get_submission_group();
+        }
+        else
+        {
+            throw std::logic_error("get_submission_group called before initialization");
+        }
+    }
+
+    // The number of selections with a deadline that no resource was predicted to meet
+    std::uint64_t
+    get_missed_deadlines() const
+    {
+        if (state_)
+        {
+            return state_->missed_deadlines_.load(std::memory_order_relaxed);
+        }
+        else
+        {
+            throw std::logic_error("get_missed_deadlines called before initialization");
+        }
+    }
+
+    // The counters are updated by select; the callback may be set at any time
+    policy_telemetry_t
+    get_telemetry() const
+    {
+        if (state_)
+        {
+            policy_telemetry_t t;
+            t.resources = state_->telemetry_.snapshot();
+            for (std::size_t i = 0; i < t.resources.size(); ++i)
+                t.resources[i].in_flight = state_->resources_[i]->in_flight_.load(std::memory_order_relaxed);
+            return t;
+        }
+        else
+        {
+            throw std::logic_error("get_telemetry called before initialization");
+        }
+    }
+
+    void
+    set_telemetry_callback(std::function<void(const telemetry_event_t&)> callback)
+    {
+        if (state_)
+        {
+            state_->telemetry_.set_callback(std::move(callback));
+        }
+        else
+        {
+            throw std::logic_error("set_telemetry_callback called before initialization");
+        }
+    }
+
+  private:
+    std::shared_ptr<backend_t> backend_;
+    std::shared_ptr<state_t> state_;
+
+    void
+    initialize_impl(int low_priority_limit)
+    {
+        if (low_priority_limit < 1)
+            throw std::invalid_argument("deadline_policy needs a low priority limit of at least 1");
+        state_ = std::make_shared<state_t>();
+        state_->low_priority_limit_ = low_priority_limit;
+        auto u = get_resources();
+        for (auto& x : u)
+            state_->resources_.push_back(std::make_unique<resource_t>(x));
+        state_->telemetry_.initialize(state_->resources_.size());
+    }
+
+    template <typename Arg>
+    static void
+    get_urgency(const Arg& arg, task_priority_t& priority, const task_deadline_t*& deadline)
+    {
+        if constexpr (std::is_same_v<std::decay_t<Arg>, task_priority_t>)
+        {
+            priority = arg;
+        }
+        else if constexpr (std::is_same_v<std::decay_t<Arg>, task_deadline_t>)
+        {
+            priority = task_priority_t::high;
+            deadline = &arg;
+        }
+    }
+
+    struct prediction_t
+    {
+        std::size_t index_ = 0;
+        // the time of a new task on the resource
+        std::int64_t task_time_ = 0;
+        // the time to complete a new task after the pending ones
+        std::int64_t completion_ = std::numeric_limits<std::int64_t>::max();
+    };
+
+    // The resource predicted to complete a new task of the priority first. The resources not measured yet
+    // are predicted the mean task time of the others, and the numbers of tasks in flight decide while nothing
+    // is measured. A high priority task does not wait for the pending low priority tasks. Returns false
+    // if the priority is low and all the resources are at the limit.
+    bool
+    find_first_completion(task_priority_t priority, prediction_t& best) const
+    {
+        best = prediction_t{};
+        const auto& resources = state_->resources_;
+        std::int64_t measured_sum = 0;
+        std::int64_t num_measured = 0;
+        for (const auto& r : resources)
+        {
+            const std::int64_t t = r->task_time_.load(std::memory_order_relaxed);
+            measured_sum += t;
+            num_measured += (t > 0);
+        }
+        const std::int64_t unmeasured_time = num_measured ? measured_sum / num_measured : 0;
+
+        bool found = false;
+        int best_in_flight = std::numeric_limits<int>::max();
+        for (std::size_t i = 0; i < resources.size(); ++i)
+        {
+            const resource_t& r = *resources[i];
+            if (priority == task_priority_t::low &&
+                r.low_in_flight_.load(std::memory_order_relaxed) >= state_->low_priority_limit_)
+                continue;
+            std::int64_t task_time = r.task_time_.load(std::memory_order_relaxed);
+            if (task_time == 0)
+                task_time = unmeasured_time;
+            std::int64_t pending_time = r.pending_time_.load(std::memory_order_relaxed);
+            if (priority == task_priority_t::high)
+                pending_time -= r.low_pending_time_.load(std::memory_order_relaxed);
+            const std::int64_t completion = std::max<std::int64_t>(pending_time, 0) + task_time;
+            const int in_flight = r.in_flight_.load(std::memory_order_relaxed);
+            if (completion < best.completion_ || (completion == best.completion_ && in_flight < best_in_flight))
+            {
+                found = true;
+                best = prediction_t{i, task_time, completion};
+                best_in_flight = in_flight;
+            }
+        }
+        return found;
+    }
+
+    // Takes one of the low priority slots of the resource, unless they are all taken
+    bool
+    try_reserve_low_priority_slot(resource_t& r) const
+    {
+        int n = r.low_in_flight_.load(std::memory_order_relaxed);
+        while (n < state_->low_priority_limit_)
+        {
+            if (r.low_in_flight_.compare_exchange_weak(n, n + 1, std::memory_order_acquire,
+                                                       std::memory_order_relaxed))
+                return true;
+        }
+        return false;
+    }
+
+    void
+    add_task_time(std::size_t index, report_duration v) const
+    {
+        resource_t& r = *state_->resources_[index];
+        const std::int64_t t = v.count();
+        const std::int64_t mean = r.task_time_.load(std::memory_order_relaxed);
+        const std::int64_t updated =
+            mean > 0 ? mean + static_cast<std::int64_t>(ewma_alpha * (t - mean)) : std::max<std::int64_t>(t, 1);
+        // a lost update from a concurrent report only delays the moving average by one sample
+        r.task_time_.store(std::max<std::int64_t>(updated, 1), std::memory_order_relaxed);
+        state_->telemetry_.on_task_time(index, static_cast<std::uint64_t>(std::max<std::int64_t>(t, 0)));
+    }
+};
+
+} // namespace experimental
+} // namespace dpl
+} // namespace oneapi
+
+#endif //_ONEDPL_DEADLINE_POLICY_H
@@ -11,18 +11,25 @@
 #define _ONEDPL_DYNAMIC_LOAD_POLICY_H
 
 #include <atomic>
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <limits>
-#include <mutex>
+#include <random>
+#include <thread>
 #include <vector>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
 #include "oneapi/dpl/internal/dynamic_selection_traits.h"
 #include "oneapi/dpl/internal/dynamic_selection_impl/backend_traits.h"
+#include "oneapi/dpl/internal/dynamic_selection_impl/telemetry.h"
 #if _DS_BACKEND_SYCL != 0
 #    include "oneapi/dpl/internal/dynamic_selection_impl/sycl_backend.h"
 #endif
+#if _DS_BACKEND_TBB != 0
+#    include "oneapi/dpl/internal/dynamic_selection_impl/tbb_backend.h"
+#endif
 
 namespace oneapi
 {
@@ -33,6 +40,8 @@ namespace experimental
 
 #if _DS_BACKEND_SYCL != 0
 template <typename Backend = sycl_backend>
+#elif _DS_BACKEND_TBB != 0
+template <typename Backend = tbb_backend>
 #else
 template <typename Backend>
 #endif
@@ -43,6 +52,9 @@ struct dynamic_load_policy
     using load_t = int;
     using execution_resource_t = typename backend_t::execution_resource_t;
 
+    // up to that many resources all the loads are compared, above it the less loaded of two random ones is taken
+    static constexpr std::size_t exact_scan_limit = 8;
+
   public:
     //Policy Traits
     using resource_type = typename backend_t::resource_type;
@@ -94,10 +106,11 @@ struct dynamic_load_policy
 
     using selection_type = dl_selection_handle_t<dynamic_load_policy<Backend>>;
 
+    // the resources are not changed after the initialization, so select reads them without a lock
     struct state_t
     {
         resource_container_t resources_;
-        std::mutex m_;
+        internal::telemetry_recorder_t telemetry_;
     };
 
     std::shared_ptr<state_t> state_;
@@ -114,6 +127,7 @@ struct dynamic_load_policy
             {
                 state_->resources_.push_back(std::make_shared<resource_t>(x));
             }
+            state_->telemetry_.initialize(state_->resources_.size());
         }
     }
 
@@ -129,6 +143,7 @@ struct dynamic_load_policy
             {
                 state_->resources_.push_back(std::make_shared<resource_t>(x));
             }
+            state_->telemetry_.initialize(state_->resources_.size());
         }
     }
 
@@ -157,20 +172,41 @@ struct dynamic_load_policy
         }
         if (state_)
         {
-            std::shared_ptr<resource_t> least_loaded;
-            int least_load = std::numeric_limits<load_t>::max();
+            const resource_container_t& resources = state_->resources_;
+            const std::size_t n = resources.size();
+            std::size_t least_loaded = 0;
 
-            std::lock_guard<std::mutex> l(state_->m_);
-            for (auto r : state_->resources_)
+            if (n <= exact_scan_limit)
             {
-                load_t v = r->load_.load();
-                if (!least_loaded || v < least_load)
+                load_t least_load = std::numeric_limits<load_t>::max();
+                for (std::size_t i = 0; i < n; ++i)
                 {
-                    least_load = v;
-                    least_loaded = ::std::move(r);
+                    load_t v = resources[i]->load_.load(std::memory_order_relaxed);
+                    if (v < least_load)
+                    {
+                        least_load = v;
+                        least_loaded = i;
+                    }
                 }
             }
-            return selection_type{dynamic_load_policy<Backend>(*this), least_loaded};
+            else
+            {
+                // power of two choices: the ties go to the lower index, as with the full scan
+                thread_local std::minstd_rand engine(
+                    static_cast<std::uint_fast32_t>(std::hash<std::thread::id>{}(std::this_thread::get_id())));
+                std::uniform_int_distribution<std::size_t> distr(0, n - 2);
+                std::size_t i = distr(engine);
+                std::size_t j = distr(engine);
+                j += (j >= i); // a different resource
+                if (j < i)
+                    std::swap(i, j);
+                least_loaded = resources[j]->load_.load(std::memory_order_relaxed) <
+                                       resources[i]->load_.load(std::memory_order_relaxed)
+                                   ? j
+                                   : i;
+            }
+            state_->telemetry_.on_selection(least_loaded);
+            return selection_type{dynamic_load_policy<Backend>(*this), resources[least_loaded]};
         }
         else
         {
@@ -200,6 +236,37 @@ struct dynamic_load_policy
             throw std::logic_error("get_submission_group called before initialization");
         }
     }
+
+    // The counters are updated by select; the callback may be set at any time
+    policy_telemetry_t
+    get_telemetry() const
+    {
+        if (state_)
+        {
+            policy_telemetry_t t;
+            t.resources = state_->telemetry_.snapshot();
+            for (std::size_t i = 0; i < t.resources.size(); ++i)
+                t.resources[i].in_flight = state_->resources_[i]->load_.load(std::memory_order_relaxed);
+            return t;
+        }
+        else
+        {
+            throw std::logic_error("get_telemetry called before initialization");
+        }
+    }
+
+    void
+    set_telemetry_callback(std::function<void(const telemetry_event_t&)> callback)
+    {
+        if (state_)
+        {
+            state_->telemetry_.set_callback(std::move(callback));
+        }
+        else
+        {
+            throw std::logic_error("set_telemetry_callback called before initialization");
+        }
+    }
 };
 } // namespace experimental
 
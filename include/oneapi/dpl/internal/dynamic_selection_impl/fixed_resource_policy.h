@@ -11,14 +11,19 @@
 #define _ONEDPL_STATIC_POLICY_IMPL_H
 #include <vector>
 #include <type_traits>
+#include <functional>
 #include <memory>
 #include <stdexcept>
 #include <utility>
 #include "oneapi/dpl/internal/dynamic_selection_traits.h"
 #include "oneapi/dpl/internal/dynamic_selection_impl/scoring_policy_defs.h"
+#include "oneapi/dpl/internal/dynamic_selection_impl/telemetry.h"
 #if _DS_BACKEND_SYCL != 0
 #    include "oneapi/dpl/internal/dynamic_selection_impl/sycl_backend.h"
 #endif
+#if _DS_BACKEND_TBB != 0
+#    include "oneapi/dpl/internal/dynamic_selection_impl/tbb_backend.h"
+#endif
 namespace oneapi
 {
 namespace dpl
@@ -28,6 +33,8 @@ namespace experimental
 
 #if _DS_BACKEND_SYCL != 0
 template <typename Backend = sycl_backend>
+#elif _DS_BACKEND_TBB != 0
+template <typename Backend = tbb_backend>
 #else
 template <typename Backend>
 #endif
@@ -53,6 +60,7 @@ struct fixed_resource_policy
     {
         resource_container_t resources_;
         ::std::size_t index_ = 0;
+        internal::telemetry_recorder_t telemetry_;
     };
 
     std::shared_ptr<state_t> state_;
@@ -86,6 +94,7 @@ struct fixed_resource_policy
             state_ = std::make_shared<state_t>();
             state_->resources_ = get_resources();
             state_->index_ = index;
+            state_->telemetry_.initialize(state_->resources_.size());
         }
     }
 
@@ -98,6 +107,7 @@ struct fixed_resource_policy
             state_ = std::make_shared<state_t>();
             state_->resources_ = get_resources();
             state_->index_ = index;
+            state_->telemetry_.initialize(state_->resources_.size());
         }
     }
 
@@ -109,6 +119,7 @@ struct fixed_resource_policy
         {
             if (!state_->resources_.empty())
             {
+                state_->telemetry_.on_selection(state_->index_);
                 return selection_type{*this, state_->resources_[state_->index_]};
             }
             return selection_type{*this};
@@ -145,6 +156,35 @@ struct fixed_resource_policy
             throw std::logic_error("get_submission_group called before initialization");
         }
     }
+
+    // The counters are updated by select; the callback may be set at any time
+    policy_telemetry_t
+    get_telemetry() const
+    {
+        if (state_)
+        {
+            policy_telemetry_t t;
+            t.resources = state_->telemetry_.snapshot();
+            return t;
+        }
+        else
+        {
+            throw std::logic_error("get_telemetry called before initialization");
+        }
+    }
+
+    void
+    set_telemetry_callback(std::function<void(const telemetry_event_t&)> callback)
+    {
+        if (state_)
+        {
+            state_->telemetry_.set_callback(std::move(callback));
+        }
+        else
+        {
+            throw std::logic_error("set_telemetry_callback called before initialization");
+        }
+    }
 };
 } //namespace experimental
 } //namespace dpl
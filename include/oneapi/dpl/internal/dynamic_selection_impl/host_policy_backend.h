@@ -0,0 +1,206 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _ONEDPL_HOST_POLICY_BACKEND_H
+#define _ONEDPL_HOST_POLICY_BACKEND_H
+
+#include "oneapi/dpl/execution"
+
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "oneapi/dpl/internal/dynamic_selection_traits.h"
+#include "oneapi/dpl/internal/dynamic_selection_impl/auto_tune_policy.h"
+
+namespace oneapi
+{
+namespace dpl
+{
+namespace experimental
+{
+
+// The standard host execution policies, as resources to select from
+enum class host_policy_t
+{
+    seq,
+    unseq,
+    par,
+    par_unseq
+};
+
+namespace internal
+{
+
+// Calls f with the execution policy object of the kind
+template <typename Function>
+decltype(auto)
+visit_host_policy(host_policy_t kind, Function&& f)
+{
+    switch (kind)
+    {
+    case host_policy_t::unseq:
+        return std::forward<Function>(f)(oneapi::dpl::execution::unseq);
+    case host_policy_t::par:
+        return std::forward<Function>(f)(oneapi::dpl::execution::par);
+    case host_policy_t::par_unseq:
+        return std::forward<Function>(f)(oneapi::dpl::execution::par_unseq);
+    default:
+        return std::forward<Function>(f)(oneapi::dpl::execution::seq);
+    }
+}
+
+// A key of auto_tune_policy for the call site of a function: the address is the same for all the calls
+// with the function type, unlike the address of a function object
+template <typename Function>
+struct host_call_site_t
+{
+};
+
+template <typename Function>
+inline host_call_site_t<Function> host_call_site{};
+
+} // namespace internal
+
+// Backend running the user function on the calling thread with the selected host execution policy,
+// which is passed to the function instead of the resource; the task time is reported on return
+class host_policy_backend
+{
+  public:
+    using resource_type = host_policy_t;
+    using wait_type = void;
+    using execution_resource_t = resource_type;
+    using resource_container_t = std::vector<execution_resource_t>;
+
+  private:
+    using report_clock_type = std::chrono::steady_clock;
+    using report_duration = std::chrono::nanoseconds;
+
+    // the tasks are complete when submit returns
+    class async_waiter
+    {
+      public:
+        void
+        wait()
+        {
+        }
+    };
+
+    class submission_group
+    {
+      public:
+        void
+        wait()
+        {
+        }
+    };
+
+  public:
+    host_policy_backend()
+        : resources_{host_policy_t::seq, host_policy_t::unseq, host_policy_t::par, host_policy_t::par_unseq}
+    {
+    }
+
+    host_policy_backend(const std::vector<resource_type>& u) : resources_(u) {}
+
+    template <typename SelectionHandle, typename Function, typename... Args>
+    auto
+    submit(SelectionHandle s, Function&& f, Args&&... args)
+    {
+        invoke(s, [&](auto&& exec) { std::forward<Function>(f)(exec, std::forward<Args>(args)...); });
+        return async_waiter{};
+    }
+
+    // Runs f(exec) with the execution policy of the selection, reports the time and returns the result
+    template <typename SelectionHandle, typename Function>
+    static decltype(auto)
+    invoke(SelectionHandle& s, Function&& f)
+    {
+        constexpr bool report_task_submission = report_info_v<SelectionHandle, execution_info::task_submission_t>;
+        constexpr bool report_task_completion = report_info_v<SelectionHandle, execution_info::task_completion_t>;
+        constexpr bool report_task_time = report_value_v<SelectionHandle, execution_info::task_time_t, report_duration>;
+
+        if constexpr (report_task_submission)
+            report(s, execution_info::task_submission);
+
+        // reports the completion on return, also if f throws, and the time if it does not
+        struct reporter_t
+        {
+            SelectionHandle& s_;
+            int exceptions_ = std::uncaught_exceptions();
+            report_clock_type::time_point t0_ = report_clock_type::now();
+
+            ~reporter_t()
+            {
+                if constexpr (report_task_time)
+                    if (std::uncaught_exceptions() == exceptions_)
+                        s_.report(execution_info::task_time,
+                                  std::chrono::duration_cast<report_duration>(report_clock_type::now() - t0_));
+                if constexpr (report_task_completion)
+                    s_.report(execution_info::task_completion);
+            }
+        } reporter{s};
+
+        return internal::visit_host_policy(unwrap(s), std::forward<Function>(f));
+    }
+
+    auto
+    get_submission_group()
+    {
+        return submission_group{};
+    }
+
+    resource_container_t
+    get_resources() const
+    {
+        return resources_;
+    }
+
+    std::string
+    get_resource_descriptor(const execution_resource_t& r) const
+    {
+        switch (r)
+        {
+        case host_policy_t::unseq:
+            return "unseq";
+        case host_policy_t::par:
+            return "par";
+        case host_policy_t::par_unseq:
+            return "par_unseq";
+        default:
+            return "seq";
+        }
+    }
+
+  private:
+    resource_container_t resources_;
+};
+
+// Learns the fastest of the host execution policies per call site and size of the input
+using host_auto_tune_policy = auto_tune_policy<host_policy_backend, std::size_t>;
+
+// Selects a host execution policy for the call site of f and the size n of its input, calls f(exec)
+// with it and returns the result; the time of the call is reported to the policy. The call sites are
+// told apart by the type of f, so f should be a lambda expression written at the call site.
+template <typename Policy, typename Function>
+decltype(auto)
+invoke_with_host_policy(Policy&& p, std::size_t n, Function&& f)
+{
+    auto s = select(p, internal::host_call_site<std::decay_t<Function>>, n);
+    return host_policy_backend::invoke(s, std::forward<Function>(f));
+}
+
+} // namespace experimental
+} // namespace dpl
+} // namespace oneapi
+
+#endif //_ONEDPL_HOST_POLICY_BACKEND_H
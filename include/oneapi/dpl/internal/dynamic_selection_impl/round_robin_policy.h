@@ -11,6 +11,7 @@
 #define _ONEDPL_ROUND_ROBIN_POLICY_IMPL_H
 
 #include <atomic>
+#include <functional>
 #include <type_traits>
 #include <vector>
 #include <memory>
@@ -19,9 +20,13 @@
 #include <utility>
 #include "oneapi/dpl/internal/dynamic_selection_traits.h"
 #include "oneapi/dpl/internal/dynamic_selection_impl/scoring_policy_defs.h"
+#include "oneapi/dpl/internal/dynamic_selection_impl/telemetry.h"
 #if _DS_BACKEND_SYCL != 0
 #    include "oneapi/dpl/internal/dynamic_selection_impl/sycl_backend.h"
 #endif
+#if _DS_BACKEND_TBB != 0
+#    include "oneapi/dpl/internal/dynamic_selection_impl/tbb_backend.h"
+#endif
 
 namespace oneapi
 {
@@ -31,6 +36,8 @@ namespace experimental
 {
 #if _DS_BACKEND_SYCL != 0
 template <typename Backend = sycl_backend>
+#elif _DS_BACKEND_TBB != 0
+template <typename Backend = tbb_backend>
 #else
 template <typename Backend>
 #endif
@@ -58,6 +65,7 @@ struct round_robin_policy
         resource_container_t resources_;
         resource_container_size_t num_contexts_;
         std::atomic<resource_container_size_t> next_context_;
+        internal::telemetry_recorder_t telemetry_;
     };
 
     std::shared_ptr<state_t> state_;
@@ -86,6 +94,7 @@ struct round_robin_policy
             state_->resources_ = get_resources();
             state_->num_contexts_ = state_->resources_.size();
             state_->next_context_ = 0;
+            state_->telemetry_.initialize(state_->num_contexts_);
         }
     }
 
@@ -99,6 +108,7 @@ struct round_robin_policy
             state_->resources_ = get_resources();
             state_->num_contexts_ = state_->resources_.size();
             state_->next_context_ = 0;
+            state_->telemetry_.initialize(state_->num_contexts_);
         }
     }
 
@@ -126,6 +136,7 @@ struct round_robin_policy
                     break;
                 }
             }
+            state_->telemetry_.on_selection(current_context_);
             auto& e = state_->resources_[current_context_];
             return selection_type{*this, e};
         }
@@ -161,6 +172,35 @@ struct round_robin_policy
             throw std::logic_error("get_submission_group called before initialization");
         }
     }
+
+    // The counters are updated by select; the callback may be set at any time
+    policy_telemetry_t
+    get_telemetry() const
+    {
+        if (state_)
+        {
+            policy_telemetry_t t;
+            t.resources = state_->telemetry_.snapshot();
+            return t;
+        }
+        else
+        {
+            throw std::logic_error("get_telemetry called before initialization");
+        }
+    }
+
+    void
+    set_telemetry_callback(std::function<void(const telemetry_event_t&)> callback)
+    {
+        if (state_)
+        {
+            state_->telemetry_.set_callback(std::move(callback));
+        }
+        else
+        {
+            throw std::logic_error("set_telemetry_callback called before initialization");
+        }
+    }
 };
 } // namespace experimental
 
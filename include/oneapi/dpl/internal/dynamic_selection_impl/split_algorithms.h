@@ -0,0 +1,337 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _ONEDPL_SPLIT_ALGORITHMS_H
+#define _ONEDPL_SPLIT_ALGORITHMS_H
+
+#include "oneapi/dpl/execution"
+#include "oneapi/dpl/algorithm"
+#include "oneapi/dpl/numeric"
+#if _DS_BACKEND_SYCL != 0
+#    include "oneapi/dpl/async"
+#endif
+
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "oneapi/dpl/internal/dynamic_selection_traits.h"
+#include "oneapi/dpl/internal/dynamic_selection_impl/policy_traits.h"
+
+namespace oneapi
+{
+namespace dpl
+{
+namespace experimental
+{
+namespace internal
+{
+
+// Runs a share of a split algorithm on a resource. The host resources, such as TBB arenas, run a host parallel
+// algorithm within the task of the backend; the result is ready when the task completes.
+template <typename Resource, typename = void>
+struct split_executor
+{
+    template <typename T>
+    struct ready_t
+    {
+        T value_;
+
+        T
+        get()
+        {
+            return value_;
+        }
+    };
+
+    struct done_t
+    {
+        void
+        get()
+        {
+        }
+    };
+
+    template <typename Wait, typename Pending>
+    static Wait
+    wait_for(Pending&)
+    {
+        return Wait{};
+    }
+
+    template <typename _Iterator, typename _T, typename _BinaryOp>
+    static ready_t<_T>
+    reduce(Resource, _Iterator first, _Iterator last, _T init, _BinaryOp op)
+    {
+        return {oneapi::dpl::reduce(oneapi::dpl::execution::par, first, last, init, op)};
+    }
+
+    template <typename _Iterator1, typename _Iterator2, typename _UnaryOp>
+    static done_t
+    transform(Resource, _Iterator1 first, _Iterator1 last, _Iterator2 result, _UnaryOp op)
+    {
+        oneapi::dpl::transform(oneapi::dpl::execution::par, first, last, result, op);
+        return {};
+    }
+
+    template <typename _Iterator, typename _Function>
+    static done_t
+    for_each(Resource, _Iterator first, _Iterator last, _Function f)
+    {
+        oneapi::dpl::for_each(oneapi::dpl::execution::par, first, last, f);
+        return {};
+    }
+
+    template <typename _Iterator, typename _Compare>
+    static done_t
+    sort(Resource, _Iterator first, _Iterator last, _Compare comp)
+    {
+        oneapi::dpl::sort(oneapi::dpl::execution::par, first, last, comp);
+        return {};
+    }
+};
+
+#if _DS_BACKEND_SYCL != 0
+// The queues run the asynchronous device algorithms; the wait object of the share is the event of the algorithm
+template <>
+struct split_executor<sycl::queue>
+{
+    template <typename Wait, typename Pending>
+    static Wait
+    wait_for(Pending& p)
+    {
+        return p.event();
+    }
+
+    template <typename _Iterator, typename _T, typename _BinaryOp>
+    static auto
+    reduce(sycl::queue q, _Iterator first, _Iterator last, _T init, _BinaryOp op)
+    {
+        return oneapi::dpl::experimental::reduce_async(oneapi::dpl::execution::make_device_policy(q), first, last, init,
+                                                       op);
+    }
+
+    template <typename _Iterator1, typename _Iterator2, typename _UnaryOp>
+    static auto
+    transform(sycl::queue q, _Iterator1 first, _Iterator1 last, _Iterator2 result, _UnaryOp op)
+    {
+        return oneapi::dpl::experimental::transform_async(oneapi::dpl::execution::make_device_policy(q), first, last,
+                                                          result, op);
+    }
+
+    template <typename _Iterator, typename _Function>
+    static auto
+    for_each(sycl::queue q, _Iterator first, _Iterator last, _Function f)
+    {
+        return oneapi::dpl::experimental::for_each_async(oneapi::dpl::execution::make_device_policy(q), first, last, f);
+    }
+
+    template <typename _Iterator, typename _Compare>
+    static auto
+    sort(sycl::queue q, _Iterator first, _Iterator last, _Compare comp)
+    {
+        return oneapi::dpl::experimental::sort_async(oneapi::dpl::execution::make_device_policy(q), first, last, comp);
+    }
+};
+#endif
+
+// Submits the shares of n elements to their resources and waits for all of them. run_share(r, i, offset, size)
+// starts the work of the share i on the resource r, keeps its pending result and returns the wait object.
+// If a share throws, the first exception is rethrown once all the shares are complete.
+template <typename Policy, typename RunShare>
+std::size_t
+split_run(Policy& p, std::size_t n, RunShare run_share)
+{
+    auto shares = p.split(n);
+    auto submit_share = [&run_share](auto& s, std::size_t i) {
+        return oneapi::dpl::experimental::submit(
+            s, [&run_share, i, offset = s.offset(), size = s.size()](auto r) { return run_share(r, i, offset, size); });
+    };
+    using waiter_t = decltype(submit_share(shares[0], 0));
+
+    std::vector<waiter_t> waiters;
+    std::exception_ptr error;
+    for (std::size_t i = 0; i < shares.size() && !error; ++i)
+    {
+        try
+        {
+            waiters.push_back(submit_share(shares[i], i));
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+    }
+    for (auto& w : waiters)
+    {
+        try
+        {
+            oneapi::dpl::experimental::wait(w);
+        }
+        catch (...)
+        {
+            if (!error)
+                error = std::current_exception();
+        }
+    }
+    if (error)
+        std::rethrow_exception(error);
+    return shares.size();
+}
+
+template <typename Policy>
+using split_executor_t = split_executor<resource_t<std::decay_t<Policy>>>;
+
+} // namespace internal
+
+// The algorithms below divide [first, last) with split of the policy, run the shares on their resources
+// and combine the partial results; the data must be accessible from all the resources and from the host
+
+template <typename Policy, typename Iterator, typename T, typename BinaryOp>
+T
+split_reduce(Policy&& p, Iterator first, Iterator last, T init, BinaryOp op)
+{
+    using executor_t = internal::split_executor_t<Policy>;
+    using wait_type = wait_t<std::decay_t<Policy>>;
+    using pending_t =
+        decltype(executor_t::reduce(std::declval<resource_t<std::decay_t<Policy>>>(), first, last, init, op));
+
+    const std::size_t n = std::distance(first, last);
+    if (n == 0)
+        return init;
+
+    // the first share starts from init, the others from their first element
+    std::vector<std::optional<pending_t>> partials(std::min(n, p.get_resources().size()));
+    const std::size_t num_shares =
+        internal::split_run(p, n, [&](auto r, std::size_t i, std::size_t offset, std::size_t size) -> wait_type {
+            Iterator share_first = std::next(first, offset);
+            Iterator share_last = std::next(share_first, size);
+            if (i == 0)
+                partials[i].emplace(executor_t::reduce(r, share_first, share_last, init, op));
+            else
+                partials[i].emplace(executor_t::reduce(r, std::next(share_first), share_last, T(*share_first), op));
+            return executor_t::template wait_for<wait_type>(*partials[i]);
+        });
+
+    T result = partials[0]->get();
+    for (std::size_t i = 1; i < num_shares; ++i)
+        result = op(result, partials[i]->get());
+    return result;
+}
+
+template <typename Policy, typename Iterator, typename T>
+T
+split_reduce(Policy&& p, Iterator first, Iterator last, T init)
+{
+    return split_reduce(std::forward<Policy>(p), first, last, init, std::plus<T>());
+}
+
+template <typename Policy, typename Iterator1, typename Iterator2, typename UnaryOp>
+Iterator2
+split_transform(Policy&& p, Iterator1 first, Iterator1 last, Iterator2 result, UnaryOp op)
+{
+    using executor_t = internal::split_executor_t<Policy>;
+    using wait_type = wait_t<std::decay_t<Policy>>;
+    using pending_t =
+        decltype(executor_t::transform(std::declval<resource_t<std::decay_t<Policy>>>(), first, last, result, op));
+
+    const std::size_t n = std::distance(first, last);
+    if (n == 0)
+        return result;
+
+    std::vector<std::optional<pending_t>> pending(std::min(n, p.get_resources().size()));
+    internal::split_run(p, n, [&](auto r, std::size_t i, std::size_t offset, std::size_t size) -> wait_type {
+        Iterator1 share_first = std::next(first, offset);
+        pending[i].emplace(
+            executor_t::transform(r, share_first, std::next(share_first, size), std::next(result, offset), op));
+        return executor_t::template wait_for<wait_type>(*pending[i]);
+    });
+    return std::next(result, n);
+}
+
+template <typename Policy, typename Iterator, typename Function>
+void
+split_for_each(Policy&& p, Iterator first, Iterator last, Function f)
+{
+    using executor_t = internal::split_executor_t<Policy>;
+    using wait_type = wait_t<std::decay_t<Policy>>;
+    using pending_t = decltype(executor_t::for_each(std::declval<resource_t<std::decay_t<Policy>>>(), first, last, f));
+
+    const std::size_t n = std::distance(first, last);
+    if (n == 0)
+        return;
+
+    std::vector<std::optional<pending_t>> pending(std::min(n, p.get_resources().size()));
+    internal::split_run(p, n, [&](auto r, std::size_t i, std::size_t offset, std::size_t size) -> wait_type {
+        Iterator share_first = std::next(first, offset);
+        pending[i].emplace(executor_t::for_each(r, share_first, std::next(share_first, size), f));
+        return executor_t::template wait_for<wait_type>(*pending[i]);
+    });
+}
+
+// The shares are sorted on their resources, then merged on the host
+template <typename Policy, typename Iterator, typename Compare>
+void
+split_sort(Policy&& p, Iterator first, Iterator last, Compare comp)
+{
+    using executor_t = internal::split_executor_t<Policy>;
+    using wait_type = wait_t<std::decay_t<Policy>>;
+    using pending_t = decltype(executor_t::sort(std::declval<resource_t<std::decay_t<Policy>>>(), first, last, comp));
+
+    const std::size_t n = std::distance(first, last);
+    if (n == 0)
+        return;
+
+    const std::size_t max_shares = std::min(n, p.get_resources().size());
+    std::vector<std::optional<pending_t>> pending(max_shares);
+    std::vector<std::size_t> bounds(max_shares + 1, n);
+    const std::size_t num_shares =
+        internal::split_run(p, n, [&](auto r, std::size_t i, std::size_t offset, std::size_t size) -> wait_type {
+            Iterator share_first = std::next(first, offset);
+            bounds[i] = offset;
+            pending[i].emplace(executor_t::sort(r, share_first, std::next(share_first, size), comp));
+            return executor_t::template wait_for<wait_type>(*pending[i]);
+        });
+    bounds.resize(num_shares + 1);
+    bounds[num_shares] = n;
+
+    // merge the neighbouring sorted shares pairwise until one is left
+    while (bounds.size() > 2)
+    {
+        std::vector<std::size_t> merged;
+        std::size_t i = 0;
+        for (; i + 2 < bounds.size(); i += 2)
+        {
+            oneapi::dpl::inplace_merge(oneapi::dpl::execution::par, std::next(first, bounds[i]),
+                                       std::next(first, bounds[i + 1]), std::next(first, bounds[i + 2]), comp);
+            merged.push_back(bounds[i]);
+        }
+        if (i + 1 < bounds.size())
+            merged.push_back(bounds[i]);
+        merged.push_back(n);
+        bounds = std::move(merged);
+    }
+}
+
+template <typename Policy, typename Iterator>
+void
+split_sort(Policy&& p, Iterator first, Iterator last)
+{
+    split_sort(std::forward<Policy>(p), first, last, std::less<typename std::iterator_traits<Iterator>::value_type>());
+}
+
+} // namespace experimental
+} // namespace dpl
+} // namespace oneapi
+
+#endif //_ONEDPL_SPLIT_ALGORITHMS_H
@@ -0,0 +1,300 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _ONEDPL_SPLIT_POLICY_H
+#define _ONEDPL_SPLIT_POLICY_H
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "oneapi/dpl/internal/dynamic_selection_traits.h"
+#include "oneapi/dpl/internal/dynamic_selection_impl/backend_traits.h"
+#if _DS_BACKEND_SYCL != 0
+#    include "oneapi/dpl/internal/dynamic_selection_impl/sycl_backend.h"
+#endif
+#if _DS_BACKEND_TBB != 0
+#    include "oneapi/dpl/internal/dynamic_selection_impl/tbb_backend.h"
+#endif
+
+namespace oneapi
+{
+namespace dpl
+{
+namespace experimental
+{
+
+// Divides a range of work into contiguous shares, one per resource, proportional to the throughputs
+// the resources have shown on the previous shares
+#if _DS_BACKEND_SYCL != 0
+template <typename Backend = sycl_backend>
+#elif _DS_BACKEND_TBB != 0
+template <typename Backend = tbb_backend>
+#else
+template <typename Backend>
+#endif
+class split_policy
+{
+    using backend_t = Backend;
+    using execution_resource_t = typename backend_t::execution_resource_t;
+    using wrapped_resource_t = execution_resource_t;
+    using report_duration = std::chrono::nanoseconds;
+
+    // weight of a new throughput in the moving average
+    static constexpr double ewma_alpha = 0.5;
+    // a resource gets at least that part of the share of the fastest one, so that its throughput is still measured
+    static constexpr double min_relative_share = 1.0 / 64;
+
+    class split_selection_type
+    {
+        using policy_t = split_policy<Backend>;
+        policy_t policy_;
+        execution_resource_t resource_;
+        std::size_t index_ = 0;
+        std::size_t offset_ = 0;
+        std::size_t size_ = 0;
+
+      public:
+        split_selection_type(const policy_t& p, execution_resource_t r, std::size_t index, std::size_t offset,
+                             std::size_t size)
+            : policy_(p), resource_(std::move(r)), index_(index), offset_(offset), size_(size)
+        {
+        }
+
+        auto
+        unwrap()
+        {
+            return ::oneapi::dpl::experimental::unwrap(resource_);
+        }
+
+        policy_t
+        get_policy()
+        {
+            return policy_;
+        };
+
+        // the share of the range, empty for the selections not made by split
+        std::size_t
+        offset() const
+        {
+            return offset_;
+        }
+
+        std::size_t
+        size() const
+        {
+            return size_;
+        }
+
+        void
+        report(const execution_info::task_time_t&, report_duration v) const
+        {
+            policy_.add_timing(index_, size_, v);
+        }
+    };
+
+  public:
+    // Needed by Policy Traits
+    using resource_type = decltype(unwrap(std::declval<wrapped_resource_t>()));
+    using wait_type = typename Backend::wait_type;
+    using selection_type = split_selection_type;
+
+    split_policy(deferred_initialization_t) {}
+
+    split_policy() { initialize(); }
+
+    split_policy(const std::vector<resource_type>& u) { initialize(u); }
+
+    void
+    initialize()
+    {
+        if (!state_)
+        {
+            backend_ = std::make_shared<backend_t>();
+            initialize_impl();
+        }
+    }
+
+    void
+    initialize(const std::vector<resource_type>& u)
+    {
+        if (!state_)
+        {
+            backend_ = std::make_shared<backend_t>(u);
+            initialize_impl();
+        }
+    }
+
+    // The fastest resource so far, for the whole work
+    template <typename... Args>
+    selection_type
+    select(Args&&...)
+    {
+        if constexpr (backend_traits::lazy_report_v<Backend>)
+        {
+            backend_->lazy_report();
+        }
+        if (state_)
+        {
+            std::lock_guard<std::mutex> l(state_->m_);
+            const auto& tp = state_->throughput_;
+            const std::size_t index = std::max_element(tp.begin(), tp.end()) - tp.begin();
+            return selection_type{*this, state_->resources_[index], index, 0, 0};
+        }
+        else
+        {
+            throw std::logic_error("select called before initialization");
+        }
+    }
+
+    // Selections of the resources with their shares of n elements, in the order of the shares;
+    // the resources with an empty share are omitted
+    std::vector<selection_type>
+    split(std::size_t n)
+    {
+        if constexpr (backend_traits::lazy_report_v<Backend>)
+        {
+            backend_->lazy_report();
+        }
+        if (!state_)
+        {
+            throw std::logic_error("split called before initialization");
+        }
+
+        std::vector<double> weights;
+        {
+            std::lock_guard<std::mutex> l(state_->m_);
+            weights = state_->throughput_;
+        }
+        // the resources not measured yet get the mean throughput of the others
+        double known_sum = 0;
+        std::size_t num_known = 0;
+        for (double w : weights)
+        {
+            known_sum += w;
+            num_known += (w > 0);
+        }
+        const double unknown = num_known ? known_sum / num_known : 1.0;
+        double max_weight = 0;
+        for (double& w : weights)
+        {
+            if (w <= 0)
+                w = unknown;
+            max_weight = std::max(max_weight, w);
+        }
+        double total = 0;
+        for (double& w : weights)
+        {
+            w = std::max(w, max_weight * min_relative_share);
+            total += w;
+        }
+
+        std::vector<selection_type> shares;
+        double cumulative = 0;
+        std::size_t begin = 0;
+        for (std::size_t i = 0; i < weights.size(); ++i)
+        {
+            cumulative += weights[i];
+            const std::size_t end = i + 1 == weights.size()
+                                        ? n
+                                        : std::min(n, static_cast<std::size_t>(std::llround(n * (cumulative / total))));
+            if (end > begin)
+            {
+                shares.push_back(selection_type{*this, state_->resources_[i], i, begin, end - begin});
+                begin = end;
+            }
+        }
+        return shares;
+    }
+
+    template <typename Function, typename... Args>
+    auto
+    submit(selection_type e, Function&& f, Args&&... args)
+    {
+        if (backend_)
+        {
+            return backend_->submit(e, std::forward<Function>(f), std::forward<Args>(args)...);
+        }
+        else
+        {
+            throw std::logic_error("submit called before initialization");
+        }
+    }
+
+    auto
+    get_resources()
+    {
+        if (backend_)
+        {
+            return backend_->get_resources();
+        }
+        else
+        {
+            throw std::logic_error("get_resources called before initialization");
+        }
+    }
+
+    auto
+    get_submission_group()
+    {
+        if (backend_)
+        {
+            return backend_->get_submission_group();
+        }
+        else
+        {
+            throw std::logic_error("get_submission_group called before initialization");
+        }
+    }
+
+  private:
+    struct state_t
+    {
+        std::mutex m_;
+        std::vector<execution_resource_t> resources_;
+        // moving averages of the elements processed per nanosecond, 0 until measured
+        std::vector<double> throughput_;
+    };
+
+    std::shared_ptr<backend_t> backend_;
+    std::shared_ptr<state_t> state_;
+
+    void
+    initialize_impl()
+    {
+        state_ = std::make_shared<state_t>();
+        auto u = get_resources();
+        state_->resources_.assign(u.begin(), u.end());
+        state_->throughput_.assign(state_->resources_.size(), 0.0);
+    }
+
+    void
+    add_timing(std::size_t index, std::size_t size, report_duration t) const
+    {
+        if (size == 0 || t.count() <= 0)
+            return;
+        const double throughput = static_cast<double>(size) / t.count();
+
+        std::lock_guard<std::mutex> l(state_->m_);
+        double& tp = state_->throughput_[index];
+        tp = tp > 0 ? tp + ewma_alpha * (throughput - tp) : throughput;
+    }
+};
+
+} // namespace experimental
+} // namespace dpl
+} // namespace oneapi
+
+#endif //_ONEDPL_SPLIT_POLICY_H
@@ -17,6 +17,7 @@
 
 #include <chrono>
 #include <ratio>
+#include <string>
 #include <vector>
 #include <memory>
 #include <utility>
@@ -40,7 +41,7 @@ class sycl_backend
   private:
     static inline bool is_profiling_enabled = false;
     using report_clock_type = std::chrono::steady_clock;
-    using report_duration = std::chrono::milliseconds;
+    using report_duration = std::chrono::nanoseconds;
 
     class async_waiter_base
     {
@@ -234,6 +235,15 @@ class sycl_backend
         return global_rank_;
     }
 
+    // the platform and device names, stable across processes
+    std::string
+    get_resource_descriptor(const execution_resource_t& r) const
+    {
+        const sycl::device d = r.get_device();
+        return d.get_platform().get_info<sycl::info::platform::name>() + "/" +
+               d.get_info<sycl::info::device::name>();
+    }
+
     void
     lazy_report()
     {
@@ -0,0 +1,252 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _ONEDPL_TBB_BACKEND_IMPL_H
+#define _ONEDPL_TBB_BACKEND_IMPL_H
+
+#include <tbb/task_arena.h>
+// TBB_INTERFACE_VERSION is not defined by task_arena.h of oneTBB
+#if __has_include(<tbb/version.h>)
+#    include <tbb/version.h>
+#endif
+#if TBB_INTERFACE_VERSION >= 12000
+#    include <tbb/info.h>
+#    define _ONEDPL_DS_TBB_NUMA_ARENAS_PRESENT 1
+#else
+#    define _ONEDPL_DS_TBB_NUMA_ARENAS_PRESENT 0
+#endif
+#include "oneapi/dpl/internal/dynamic_selection_traits.h"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace oneapi
+{
+namespace dpl
+{
+namespace experimental
+{
+
+// Host backend: the resources are TBB task arenas and the user function is executed
+// asynchronously inside the selected arena, so nested TBB parallelism stays in that arena
+class tbb_backend
+{
+  public:
+    using resource_type = std::shared_ptr<tbb::task_arena>;
+    using wait_type = std::shared_future<void>;
+    using execution_resource_t = resource_type;
+    using resource_container_t = std::vector<execution_resource_t>;
+
+  private:
+    using report_clock_type = std::chrono::steady_clock;
+    using report_duration = std::chrono::nanoseconds;
+
+    class async_waiter
+    {
+        wait_type f_;
+
+      public:
+        async_waiter() = default;
+        async_waiter(wait_type f) : f_(std::move(f)) {}
+
+        wait_type
+        unwrap()
+        {
+            return f_;
+        }
+
+        // rethrows the exception of the user function, if any
+        void
+        wait()
+        {
+            f_.get();
+        }
+    };
+
+    // Number of the tasks submitted through the backend and not yet completed
+    struct submission_state_t
+    {
+        std::mutex m_;
+        std::condition_variable cv_;
+        std::size_t in_flight_ = 0;
+
+        void
+        add()
+        {
+            std::lock_guard<std::mutex> l(m_);
+            ++in_flight_;
+        }
+
+        void
+        remove()
+        {
+            std::lock_guard<std::mutex> l(m_);
+            if (--in_flight_ == 0)
+                cv_.notify_all();
+        }
+
+        void
+        wait()
+        {
+            std::unique_lock<std::mutex> l(m_);
+            cv_.wait(l, [this] { return in_flight_ == 0; });
+        }
+    };
+
+    class submission_group
+    {
+        std::shared_ptr<submission_state_t> state_;
+
+      public:
+        submission_group(std::shared_ptr<submission_state_t> s) : state_(std::move(s)) {}
+
+        // must not be called from a task running in one of the arenas
+        void
+        wait()
+        {
+            state_->wait();
+        }
+    };
+
+    // The enqueued task; TBB calls it as a const object, while the user function may be mutable
+    template <typename SelectionHandle, typename Function, typename ArgsTuple>
+    struct task_t
+    {
+        mutable SelectionHandle s_;
+        mutable Function f_;
+        mutable ArgsTuple args_;
+        resource_type r_;
+        std::shared_ptr<std::promise<void>> p_;
+        std::shared_ptr<submission_state_t> state_;
+
+        void
+        operator()() const
+        {
+            constexpr bool report_task_completion = report_info_v<SelectionHandle, execution_info::task_completion_t>;
+            constexpr bool report_task_time =
+                report_value_v<SelectionHandle, execution_info::task_time_t, report_duration>;
+
+            try
+            {
+                const auto t0 = report_clock_type::now();
+                std::apply([this](auto&... args) { f_(r_, args...); }, args_);
+
+                if constexpr (report_task_time)
+                    s_.report(execution_info::task_time,
+                              std::chrono::duration_cast<report_duration>(report_clock_type::now() - t0));
+                if constexpr (report_task_completion)
+                    s_.report(execution_info::task_completion);
+                p_->set_value();
+            }
+            catch (...)
+            {
+                if constexpr (report_task_completion)
+                    s_.report(execution_info::task_completion);
+                p_->set_exception(std::current_exception());
+            }
+            state_->remove();
+        }
+    };
+
+  public:
+    tbb_backend(const tbb_backend&) = delete;
+    tbb_backend&
+    operator=(const tbb_backend&) = delete;
+
+    tbb_backend() : state_(std::make_shared<submission_state_t>()) { initialize_default_resources(); }
+
+    // The arenas must have worker threads available for the enqueued tasks,
+    // e.g. be created with no slots reserved for application threads
+    template <typename NativeUniverseVector>
+    tbb_backend(const NativeUniverseVector& v) : state_(std::make_shared<submission_state_t>())
+    {
+        global_rank_.reserve(v.size());
+        for (auto e : v)
+        {
+            global_rank_.push_back(e);
+        }
+    }
+
+    template <typename SelectionHandle, typename Function, typename... Args>
+    auto
+    submit(SelectionHandle s, Function&& f, Args&&... args)
+    {
+        constexpr bool report_task_submission = report_info_v<SelectionHandle, execution_info::task_submission_t>;
+
+        auto p = std::make_shared<std::promise<void>>();
+        wait_type w = p->get_future().share();
+
+        if constexpr (report_task_submission)
+            report(s, execution_info::task_submission);
+
+        resource_type r = unwrap(s);
+        state_->add();
+        r->enqueue(task_t<SelectionHandle, std::decay_t<Function>, std::tuple<std::decay_t<Args>...>>{
+            s, std::forward<Function>(f), std::make_tuple(std::forward<Args>(args)...), r, std::move(p), state_});
+
+        return async_waiter{std::move(w)};
+    }
+
+    auto
+    get_submission_group()
+    {
+        return submission_group{state_};
+    }
+
+    auto
+    get_resources()
+    {
+        return global_rank_;
+    }
+
+    // the arenas are not named, so they are told apart by their concurrency and their position
+    std::string
+    get_resource_descriptor(const execution_resource_t& r) const
+    {
+        auto it = std::find(global_rank_.begin(), global_rank_.end(), r);
+        return "arena" + std::to_string(it - global_rank_.begin()) + "/" + std::to_string(r->max_concurrency());
+    }
+
+  private:
+    resource_container_t global_rank_;
+    std::shared_ptr<submission_state_t> state_;
+
+    // One arena per NUMA node; no slots are reserved for application threads since
+    // the tasks are enqueued and executed by the arena workers only
+    void
+    initialize_default_resources()
+    {
+#if _ONEDPL_DS_TBB_NUMA_ARENAS_PRESENT
+        for (auto numa_id : tbb::info::numa_nodes())
+        {
+            global_rank_.push_back(
+                std::make_shared<tbb::task_arena>(tbb::task_arena::constraints{numa_id}, /*reserved_for_masters*/ 0));
+        }
+#else
+        global_rank_.push_back(std::make_shared<tbb::task_arena>(tbb::task_arena::automatic, 0));
+#endif
+    }
+};
+
+} //namespace experimental
+} //namespace dpl
+} //namespace oneapi
+
+#endif /*_ONEDPL_TBB_BACKEND_IMPL_H*/
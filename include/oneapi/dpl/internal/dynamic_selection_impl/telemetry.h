@@ -0,0 +1,206 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _ONEDPL_DS_TELEMETRY_H
+#define _ONEDPL_DS_TELEMETRY_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace oneapi
+{
+namespace dpl
+{
+namespace experimental
+{
+
+// Task times in nanoseconds by powers of two: the bucket i counts the times t with 2^(i-1) <= t < 2^i,
+// the last bucket counts all longer times
+inline constexpr std::size_t latency_histogram_size = 48;
+using latency_histogram_t = std::array<std::uint64_t, latency_histogram_size>;
+
+enum class telemetry_event_kind_t
+{
+    selection,           // a resource is selected
+    task_time,           // the time of a task run on a resource is reported
+    profiling,           // auto_tune_policy selects a resource to time instead of the best one
+    best_resource_change // auto_tune_policy changes the best resource of a key
+};
+
+struct telemetry_event_t
+{
+    telemetry_event_kind_t kind;
+    // the index of the resource in get_resources()
+    std::size_t resource_index;
+    // the task time in nanoseconds for task_time, 0 otherwise
+    std::uint64_t value;
+    // the key of auto_tune_policy, empty for the other policies
+    std::string_view key;
+};
+
+struct resource_telemetry_t
+{
+    std::uint64_t selections = 0;
+    // submitted and not completed tasks, for the policies tracking the load
+    std::int64_t in_flight = 0;
+    // for the policies receiving the task times
+    latency_histogram_t latency{};
+};
+
+struct key_telemetry_t
+{
+    std::string key;
+    std::size_t best_resource = 0;
+    std::uint64_t profiling_selections = 0;
+    std::uint64_t best_resource_changes = 0;
+    // by resource index
+    std::vector<latency_histogram_t> latency;
+};
+
+struct policy_telemetry_t
+{
+    // by resource index
+    std::vector<resource_telemetry_t> resources;
+    std::vector<key_telemetry_t> keys;
+};
+
+namespace internal
+{
+
+inline std::size_t
+latency_bucket(std::uint64_t ns)
+{
+    std::size_t bucket = 0;
+    for (; ns != 0 && bucket < latency_histogram_size - 1; ns >>= 1)
+        ++bucket;
+    return bucket;
+}
+
+// The counters are kept in several stripes, and each thread updates the counters of its own stripe,
+// so that the threads selecting concurrently do not contend for the same cache lines
+inline constexpr std::size_t telemetry_stripes = 16;
+
+inline std::size_t
+telemetry_stripe()
+{
+    static std::atomic<std::size_t> next_stripe{0};
+    thread_local const std::size_t stripe = next_stripe.fetch_add(1, std::memory_order_relaxed) % telemetry_stripes;
+    return stripe;
+}
+
+// Per-resource counters updated by the policies with relaxed atomics, and the optional user callback
+class telemetry_recorder_t
+{
+    using callback_t = std::function<void(const telemetry_event_t&)>;
+
+    struct alignas(64) counters_t
+    {
+        std::atomic<std::uint64_t> selections_{0};
+        std::array<std::atomic<std::uint64_t>, latency_histogram_size> latency_{};
+    };
+
+    std::size_t size_ = 0;
+    // telemetry_stripes rows of size_ counters
+    std::unique_ptr<counters_t[]> counters_;
+
+    // the callback is replaced under the mutex, while the events being notified keep the previous one alive;
+    // without a callback, the events are not notified at all
+    std::atomic<bool> has_callback_{false};
+    mutable std::mutex callback_m_;
+    std::shared_ptr<const callback_t> callback_;
+
+    counters_t&
+    local_counters(std::size_t index)
+    {
+        return counters_[telemetry_stripe() * size_ + index];
+    }
+
+  public:
+    telemetry_recorder_t() = default;
+
+    void
+    initialize(std::size_t size)
+    {
+        size_ = size;
+        counters_ = std::make_unique<counters_t[]>(size * telemetry_stripes);
+    }
+
+    // may be called concurrently with the selections
+    void
+    set_callback(callback_t callback)
+    {
+        std::shared_ptr<const callback_t> c;
+        if (callback)
+            c = std::make_shared<const callback_t>(std::move(callback));
+        std::lock_guard<std::mutex> l(callback_m_);
+        has_callback_.store(c != nullptr, std::memory_order_release);
+        callback_.swap(c);
+    }
+
+    void
+    notify(telemetry_event_kind_t kind, std::size_t index, std::string_view key = {}, std::uint64_t value = 0) const
+    {
+        if (!has_callback_.load(std::memory_order_acquire))
+            return;
+        std::shared_ptr<const callback_t> c;
+        {
+            std::lock_guard<std::mutex> l(callback_m_);
+            c = callback_;
+        }
+        if (c)
+            (*c)(telemetry_event_t{kind, index, value, key});
+    }
+
+    void
+    on_selection(std::size_t index, std::string_view key = {})
+    {
+        local_counters(index).selections_.fetch_add(1, std::memory_order_relaxed);
+        notify(telemetry_event_kind_t::selection, index, key);
+    }
+
+    void
+    on_task_time(std::size_t index, std::uint64_t ns, std::string_view key = {})
+    {
+        local_counters(index).latency_[latency_bucket(ns)].fetch_add(1, std::memory_order_relaxed);
+        notify(telemetry_event_kind_t::task_time, index, key, ns);
+    }
+
+    std::vector<resource_telemetry_t>
+    snapshot() const
+    {
+        std::vector<resource_telemetry_t> resources(size_);
+        for (std::size_t stripe = 0; stripe < telemetry_stripes; ++stripe)
+        {
+            for (std::size_t i = 0; i < size_; ++i)
+            {
+                const counters_t& c = counters_[stripe * size_ + i];
+                resources[i].selections += c.selections_.load(std::memory_order_relaxed);
+                for (std::size_t b = 0; b < latency_histogram_size; ++b)
+                    resources[i].latency[b] += c.latency_[b].load(std::memory_order_relaxed);
+            }
+        }
+        return resources;
+    }
+};
+
+} // namespace internal
+
+} // namespace experimental
+} // namespace dpl
+} // namespace oneapi
+
+#endif /*_ONEDPL_DS_TELEMETRY_H*/
@@ -0,0 +1,32 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _ONEDPL_GATHER_SCATTER_EXTENSION_DEFS_H
+#define _ONEDPL_GATHER_SCATTER_EXTENSION_DEFS_H
+
+#include "../pstl/onedpl_config.h"
+
+namespace oneapi
+{
+namespace dpl
+{
+
+template <typename Policy, typename InputIterator1, typename InputIterator2, typename OutputIterator>
+oneapi::dpl::__internal::__enable_if_execution_policy<Policy, OutputIterator>
+gather(Policy&& policy, InputIterator1 map_first, InputIterator1 map_last, InputIterator2 input_first,
+       OutputIterator result);
+
+template <typename Policy, typename InputIterator1, typename InputIterator2, typename OutputIterator>
+oneapi::dpl::__internal::__enable_if_execution_policy<Policy, void>
+scatter(Policy&& policy, InputIterator1 first, InputIterator1 last, InputIterator2 map_first, OutputIterator result);
+
+} // end namespace dpl
+} // end namespace oneapi
+
+#endif // _ONEDPL_GATHER_SCATTER_EXTENSION_DEFS_H
@@ -0,0 +1,51 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _ONEDPL_GATHER_SCATTER_IMPL_H
+#define _ONEDPL_GATHER_SCATTER_IMPL_H
+
+#include <utility>
+
+#include "../pstl/iterator_impl.h"
+#include "gather_scatter_extension_defs.h"
+#include "../pstl/utils.h"
+
+namespace oneapi
+{
+namespace dpl
+{
+
+// Both algorithms copy through a permutation_iterator over the indexed sequence. Over contiguous elements with
+// contiguous integer indices, the unsequenced policies index it with vector gathers and scatters, and the other
+// policies prefetch the indexed elements ahead of the copy (see ONEDPL_PREFETCH_DISTANCE).
+
+// result[i] = input_first[map_first[i]] for each i in [0, map_last - map_first)
+template <typename Policy, typename InputIterator1, typename InputIterator2, typename OutputIterator>
+oneapi::dpl::__internal::__enable_if_execution_policy<Policy, OutputIterator>
+gather(Policy&& policy, InputIterator1 map_first, InputIterator1 map_last, InputIterator2 input_first,
+       OutputIterator result)
+{
+    auto __permuted_first = oneapi::dpl::make_permutation_iterator(input_first, map_first);
+    return oneapi::dpl::copy(std::forward<Policy>(policy), __permuted_first, __permuted_first + (map_last - map_first),
+                             result);
+}
+
+// result[map_first[i]] = first[i] for each i in [0, last - first); the indices are expected to be distinct
+template <typename Policy, typename InputIterator1, typename InputIterator2, typename OutputIterator>
+oneapi::dpl::__internal::__enable_if_execution_policy<Policy, void>
+scatter(Policy&& policy, InputIterator1 first, InputIterator1 last, InputIterator2 map_first, OutputIterator result)
+{
+    oneapi::dpl::copy(std::forward<Policy>(policy), first, last,
+                      oneapi::dpl::make_permutation_iterator(result, map_first));
+}
+
+} // end namespace dpl
+} // end namespace oneapi
+
+#endif // _ONEDPL_GATHER_SCATTER_IMPL_H
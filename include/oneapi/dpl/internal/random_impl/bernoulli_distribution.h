@@ -128,6 +128,22 @@ class bernoulli_distribution
         return result_portion_internal<size_of_type_, _Engine>(__engine, __params, __random_nums);
     }
 
+    // Fill the range with the values of consecutive operator () calls
+    template <class _Engine, class _ForwardIt>
+    void
+    generate(_Engine& __engine, _ForwardIt __first, _ForwardIt __last)
+    {
+        generate<_Engine, _ForwardIt>(__engine, param(), __first, __last);
+    }
+
+    template <class _Engine, class _ForwardIt>
+    void
+    generate(_Engine& __engine, const param_type& __params, _ForwardIt __first, _ForwardIt __last)
+    {
+        for (; __first != __last; ++__first)
+            *__first = operator()(__engine, __params);
+    }
+
     friend bool
     operator==(const bernoulli_distribution& __x, const bernoulli_distribution& __y)
     {
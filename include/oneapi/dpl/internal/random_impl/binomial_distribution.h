@@ -0,0 +1,384 @@
+// -*- C++ -*-
+//===-- binomial_distribution.h -------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// This file incorporates work covered by the following copyright and permission
+// notice:
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+//
+//===----------------------------------------------------------------------===//
+//
+// Abstract:
+//
+// Public header file provides implementation for Binomial Distribution
+
+#ifndef _ONEDPL_BINOMIAL_DISTRIBUTION_H
+#define _ONEDPL_BINOMIAL_DISTRIBUTION_H
+
+namespace oneapi
+{
+namespace dpl
+{
+template <class _IntType = int>
+class binomial_distribution
+{
+  public:
+    // Distribution types
+    using result_type = _IntType;
+    using scalar_type = internal::element_type_t<_IntType>;
+    class param_type
+    {
+      public:
+        using distribution_type = binomial_distribution<result_type>;
+        param_type() : param_type(scalar_type{1}) {}
+        explicit param_type(scalar_type t, double p = 0.5) : t_(t), p_(p) {}
+        scalar_type
+        t() const
+        {
+            return t_;
+        }
+        double
+        p() const
+        {
+            return p_;
+        }
+        friend bool
+        operator==(const param_type& p1, const param_type& p2)
+        {
+            return p1.t_ == p2.t_ && p1.p_ == p2.p_;
+        }
+        friend bool
+        operator!=(const param_type& p1, const param_type& p2)
+        {
+            return !(p1 == p2);
+        }
+
+      private:
+        scalar_type t_;
+        double p_;
+    };
+
+    // Constructors
+    binomial_distribution() : binomial_distribution(scalar_type{1}) {}
+    explicit binomial_distribution(scalar_type __t, double __p = 0.5) : t_(__t), p_(__p) {}
+    explicit binomial_distribution(const param_type& __params) : t_(__params.t()), p_(__params.p()) {}
+
+    // Reset function
+    void
+    reset()
+    {
+    }
+
+    // Property functions
+    scalar_type
+    t() const
+    {
+        return t_;
+    }
+
+    double
+    p() const
+    {
+        return p_;
+    }
+
+    param_type
+    param() const
+    {
+        return param_type(t_, p_);
+    }
+
+    void
+    param(const param_type& __params)
+    {
+        t_ = __params.t();
+        p_ = __params.p();
+    }
+
+    scalar_type
+    min() const
+    {
+        return scalar_type{};
+    }
+
+    scalar_type
+    max() const
+    {
+        return t_;
+    }
+
+    // Generate functions
+    template <class _Engine>
+    result_type
+    operator()(_Engine& __engine)
+    {
+        return operator()<_Engine>(__engine, param_type(t_, p_));
+    }
+
+    template <class _Engine>
+    result_type
+    operator()(_Engine& __engine, const param_type& __params)
+    {
+        return generate<size_of_type_, _Engine>(__engine, __params);
+    }
+
+    template <class _Engine>
+    result_type
+    operator()(_Engine& __engine, unsigned int __random_nums)
+    {
+        return operator()<_Engine>(__engine, param_type(t_, p_), __random_nums);
+    }
+
+    template <class _Engine>
+    result_type
+    operator()(_Engine& __engine, const param_type& __params, unsigned int __random_nums)
+    {
+        return result_portion_internal<size_of_type_, _Engine>(__engine, __params, __random_nums);
+    }
+
+    // Fill the range with the values of consecutive operator () calls
+    template <class _Engine, class _ForwardIt>
+    void
+    generate(_Engine& __engine, _ForwardIt __first, _ForwardIt __last)
+    {
+        generate<_Engine, _ForwardIt>(__engine, param(), __first, __last);
+    }
+
+    template <class _Engine, class _ForwardIt>
+    void
+    generate(_Engine& __engine, const param_type& __params, _ForwardIt __first, _ForwardIt __last)
+    {
+        for (; __first != __last; ++__first)
+            *__first = operator()(__engine, __params);
+    }
+
+    friend bool
+    operator==(const binomial_distribution& __x, const binomial_distribution& __y)
+    {
+        return __x.param() == __y.param();
+    }
+
+    friend bool
+    operator!=(const binomial_distribution& __x, const binomial_distribution& __y)
+    {
+        return !(__x == __y);
+    }
+
+    template <class CharT, class Traits>
+    friend ::std::basic_ostream<CharT, Traits>&
+    operator<<(::std::basic_ostream<CharT, Traits>& __os, const binomial_distribution& __d)
+    {
+        internal::save_stream_flags<CharT, Traits> __flags(__os);
+
+        __os.setf(std::ios_base::dec | std::ios_base::left);
+        CharT __sp = __os.widen(' ');
+        __os.fill(__sp);
+
+        return __os << __d.t() << __sp << __d.p();
+    }
+
+    friend const sycl::stream&
+    operator<<(const sycl::stream& __os, const binomial_distribution& __d)
+    {
+        return __os << __d.t() << ' ' << __d.p();
+    }
+
+    template <class CharT, class Traits>
+    friend ::std::basic_istream<CharT, Traits>&
+    operator>>(::std::basic_istream<CharT, Traits>& __is, binomial_distribution& __d)
+    {
+        internal::save_stream_flags<CharT, Traits> __flags(__is);
+
+        __is.setf(std::ios_base::dec);
+
+        scalar_type __t;
+        double __p;
+        if (__is >> __t >> __p)
+            __d.param(binomial_distribution::param_type(__t, __p));
+
+        return __is;
+    }
+
+  private:
+    // Size of type
+    static constexpr int size_of_type_ = internal::type_traits_t<result_type>::num_elems;
+
+    // Static asserts
+    static_assert(::std::is_integral_v<scalar_type>,
+                  "oneapi::dpl::binomial_distribution. Error: unsupported data type");
+
+    // Distribution parameters
+    scalar_type t_;
+    double p_;
+
+    // Below this value of t * min(p, 1 - p) the inversion is faster than the transformed rejection
+    static constexpr double btrs_threshold_ = 10.0;
+
+    // Constants of the generation methods, computed once per call and shared by all the vector elements.
+    // The generation is done for min(p, 1 - p) and the result is mirrored if p > 0.5
+    struct constants
+    {
+        double n;
+        double p;
+        bool mirror;
+        // Inversion
+        double log_q;
+        // BTRS
+        double a;
+        double b;
+        double c;
+        double alpha;
+        double v_r;
+        double r;
+        double m;
+        double upper_bound_m;
+    };
+
+    // Tail of the Stirling approximation: log(k!) - (k + 0.5) * log(k + 1) + (k + 1) - 0.5 * log(2 * pi)
+    static double
+    stirling_approx_tail(double __k)
+    {
+        if (__k <= 9.0)
+        {
+            const double __tail_values[] = {0.0810614667953272,  0.0413406959554092,  0.0276779256849983,
+                                            0.02079067210376509, 0.0166446911898211,  0.0138761288230707,
+                                            0.0118967099458917,  0.0104112652619720,  0.00925546218271273,
+                                            0.00833056343336287};
+            return __tail_values[static_cast<int>(__k)];
+        }
+        const double __kp1sq = (__k + 1.0) * (__k + 1.0);
+        return (1.0 / 12.0 - (1.0 / 360.0 - 1.0 / 1260.0 / __kp1sq) / __kp1sq) / (__k + 1.0);
+    }
+
+    static constants
+    make_constants(const param_type& __params)
+    {
+        constants __c;
+        __c.n = static_cast<double>(__params.t());
+        __c.mirror = __params.p() > 0.5;
+        __c.p = __c.mirror ? 1.0 - __params.p() : __params.p();
+
+        const double __q = 1.0 - __c.p;
+        __c.log_q = sycl::log(__q);
+
+        const double __spq = sycl::sqrt(__c.n * __c.p * __q);
+        __c.b = 1.15 + 2.53 * __spq;
+        __c.a = -0.0873 + 0.0248 * __c.b + 0.01 * __c.p;
+        __c.c = __c.n * __c.p + 0.5;
+        __c.alpha = (2.83 + 5.1 / __c.b) * __spq;
+        __c.v_r = 0.92 - 4.2 / __c.b;
+        __c.r = __c.p / __q;
+        __c.m = sycl::floor((__c.n + 1.0) * __c.p);
+        __c.upper_bound_m = (__c.m + 0.5) * sycl::log((__c.m + 1.0) / (__c.r * (__c.n - __c.m + 1.0))) +
+                            stirling_approx_tail(__c.m) + stirling_approx_tail(__c.n - __c.m);
+        return __c;
+    }
+
+    // Inversion by the sum of the geometric waiting times, the expected number of iterations is t * p + 1
+    template <class _Engine>
+    static double
+    generate_inversion(_Engine& __engine, const constants& __c)
+    {
+        oneapi::dpl::uniform_real_distribution<double> __u;
+        double __k = 0.0;
+        double __geom_sum = 0.0;
+        while (true)
+        {
+            __geom_sum += sycl::ceil(sycl::log(1.0 - __u(__engine)) / __c.log_q);
+            if (__geom_sum > __c.n)
+                return __k;
+            __k += 1.0;
+        }
+    }
+
+    // Transformed rejection with squeeze (BTRS, W. Hormann): a bounded number of scalar operations
+    // per attempt, so each element of a vector is generated independently
+    template <class _Engine>
+    static double
+    generate_btrs(_Engine& __engine, const constants& __c)
+    {
+        oneapi::dpl::uniform_real_distribution<double> __u;
+        while (true)
+        {
+            const double __uu = __u(__engine) - 0.5;
+            double __v = __u(__engine);
+            const double __us = 0.5 - sycl::fabs(__uu);
+            const double __k = sycl::floor((2.0 * __c.a / __us + __c.b) * __uu + __c.c);
+
+            if (__us >= 0.07 && __v <= __c.v_r)
+                return __k;
+            if (__k < 0.0 || __k > __c.n)
+                continue;
+
+            __v = sycl::log(__v * __c.alpha / (__c.a / (__us * __us) + __c.b));
+            const double __upper_bound = __c.upper_bound_m +
+                                         (__c.n + 1.0) * sycl::log((__c.n - __c.m + 1.0) / (__c.n - __k + 1.0)) +
+                                         (__k + 0.5) * sycl::log(__c.r * (__c.n - __k + 1.0) / (__k + 1.0)) -
+                                         stirling_approx_tail(__k) - stirling_approx_tail(__c.n - __k);
+            if (__v <= __upper_bound)
+                return __k;
+        }
+    }
+
+    template <class _Engine>
+    static scalar_type
+    generate_scalar(_Engine& __engine, const constants& __c)
+    {
+        double __k = 0.0;
+        if (__c.p > 0.0)
+            __k = (__c.n * __c.p < btrs_threshold_) ? generate_inversion(__engine, __c) : generate_btrs(__engine, __c);
+        return static_cast<scalar_type>(__c.mirror ? __c.n - __k : __k);
+    }
+
+    // Implementation for generate function
+    template <int _Ndistr, class _Engine>
+    ::std::enable_if_t<(_Ndistr != 0), result_type>
+    generate(_Engine& __engine, const param_type& __params)
+    {
+        return generate_n_elems<_Engine>(__engine, __params, _Ndistr);
+    }
+
+    // Specialization of the scalar generation
+    template <int _Ndistr, class _Engine>
+    ::std::enable_if_t<(_Ndistr == 0), result_type>
+    generate(_Engine& __engine, const param_type& __params)
+    {
+        return generate_scalar(__engine, make_constants(__params));
+    }
+
+    // Implementation for the N vector's elements generation
+    template <class _Engine>
+    result_type
+    generate_n_elems(_Engine& __engine, const param_type& __params, unsigned int __N)
+    {
+        result_type __res;
+        const constants __c = make_constants(__params);
+        for (unsigned int __i = 0; __i < __N; ++__i)
+            __res[__i] = generate_scalar(__engine, __c);
+        return __res;
+    }
+
+    // Implementation for result_portion function
+    template <int _Ndistr, class _Engine>
+    ::std::enable_if_t<(_Ndistr != 0), result_type>
+    result_portion_internal(_Engine& __engine, const param_type& __params, unsigned int __N)
+    {
+        result_type __part_vec;
+        if (__N == 0)
+            return __part_vec;
+        else if (__N >= _Ndistr)
+            return operator()(__engine, __params);
+
+        __part_vec = generate_n_elems(__engine, __params, __N);
+        return __part_vec;
+    }
+};
+} // namespace dpl
+} // namespace oneapi
+
+#endif // _ONEDPL_BINOMIAL_DISTRIBUTION_H
@@ -0,0 +1,209 @@
+// -*- C++ -*-
+//===-- chi_squared_distribution.h ----------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// This file incorporates work covered by the following copyright and permission
+// notice:
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+//
+//===----------------------------------------------------------------------===//
+//
+// Abstract:
+//
+// Public header file provides implementation for Chi-squared Distribution
+
+#ifndef _ONEDPL_CHI_SQUARED_DISTRIBUTION_H
+#define _ONEDPL_CHI_SQUARED_DISTRIBUTION_H
+
+namespace oneapi
+{
+namespace dpl
+{
+template <class _RealType = double>
+class chi_squared_distribution
+{
+  public:
+    // Distribution types
+    using result_type = _RealType;
+    using scalar_type = internal::element_type_t<_RealType>;
+    class param_type
+    {
+      public:
+        using distribution_type = chi_squared_distribution<result_type>;
+        param_type() : param_type(scalar_type{1.0}) {}
+        explicit param_type(scalar_type n) : n_(n) {}
+        scalar_type
+        n() const
+        {
+            return n_;
+        }
+        friend bool
+        operator==(const param_type& p1, const param_type& p2)
+        {
+            return p1.n_ == p2.n_;
+        }
+        friend bool
+        operator!=(const param_type& p1, const param_type& p2)
+        {
+            return !(p1 == p2);
+        }
+
+      private:
+        scalar_type n_;
+    };
+
+    // Constructors
+    chi_squared_distribution() : chi_squared_distribution(scalar_type{1.0}) {}
+    explicit chi_squared_distribution(scalar_type __n) : gd_(__n / scalar_type{2.0}, scalar_type{2.0}) {}
+    explicit chi_squared_distribution(const param_type& __params) : chi_squared_distribution(__params.n()) {}
+
+    // Reset function
+    void
+    reset()
+    {
+        gd_.reset();
+    }
+
+    // Property functions
+    scalar_type
+    n() const
+    {
+        return gd_.alpha() * scalar_type{2.0};
+    }
+
+    param_type
+    param() const
+    {
+        return param_type(n());
+    }
+
+    void
+    param(const param_type& __params)
+    {
+        gd_.param(gamma_distr_param_type(__params.n() / scalar_type{2.0}, scalar_type{2.0}));
+    }
+
+    scalar_type
+    min() const
+    {
+        return scalar_type{};
+    }
+
+    scalar_type
+    max() const
+    {
+        return ::std::numeric_limits<scalar_type>::max();
+    }
+
+    // Generate functions
+    template <class _Engine>
+    result_type
+    operator()(_Engine& __engine)
+    {
+        return gd_(__engine);
+    }
+
+    template <class _Engine>
+    result_type
+    operator()(_Engine& __engine, const param_type& __params)
+    {
+        return gd_(__engine, gamma_distr_param_type(__params.n() / scalar_type{2.0}, scalar_type{2.0}));
+    }
+
+    template <class _Engine>
+    result_type
+    operator()(_Engine& __engine, unsigned int __random_nums)
+    {
+        return gd_(__engine, __random_nums);
+    }
+
+    template <class _Engine>
+    result_type
+    operator()(_Engine& __engine, const param_type& __params, unsigned int __random_nums)
+    {
+        return gd_(__engine, gamma_distr_param_type(__params.n() / scalar_type{2.0}, scalar_type{2.0}),
+                   __random_nums);
+    }
+
+    // Fill the range with the values of consecutive operator () calls
+    template <class _Engine, class _ForwardIt>
+    void
+    generate(_Engine& __engine, _ForwardIt __first, _ForwardIt __last)
+    {
+        generate<_Engine, _ForwardIt>(__engine, param(), __first, __last);
+    }
+
+    template <class _Engine, class _ForwardIt>
+    void
+    generate(_Engine& __engine, const param_type& __params, _ForwardIt __first, _ForwardIt __last)
+    {
+        for (; __first != __last; ++__first)
+            *__first = operator()(__engine, __params);
+    }
+
+    friend bool
+    operator==(const chi_squared_distribution& __x, const chi_squared_distribution& __y)
+    {
+        return __x.gd_ == __y.gd_;
+    }
+
+    friend bool
+    operator!=(const chi_squared_distribution& __x, const chi_squared_distribution& __y)
+    {
+        return !(__x == __y);
+    }
+
+    template <class CharT, class Traits>
+    friend ::std::basic_ostream<CharT, Traits>&
+    operator<<(::std::basic_ostream<CharT, Traits>& __os, const chi_squared_distribution& __d)
+    {
+        internal::save_stream_flags<CharT, Traits> __flags(__os);
+
+        __os.setf(std::ios_base::dec | std::ios_base::left);
+        __os.fill(__os.widen(' '));
+
+        return __os << __d.n();
+    }
+
+    friend const sycl::stream&
+    operator<<(const sycl::stream& __os, const chi_squared_distribution& __d)
+    {
+        return __os << __d.n();
+    }
+
+    template <class CharT, class Traits>
+    friend ::std::basic_istream<CharT, Traits>&
+    operator>>(::std::basic_istream<CharT, Traits>& __is, chi_squared_distribution& __d)
+    {
+        internal::save_stream_flags<CharT, Traits> __flags(__is);
+
+        __is.setf(std::ios_base::dec);
+
+        scalar_type __n;
+        if (__is >> __n)
+            __d.param(chi_squared_distribution::param_type(__n));
+
+        return __is;
+    }
+
+  private:
+    // Chi-squared distribution with n degrees of freedom is Gamma(n / 2, 2)
+    using gamma_distr = oneapi::dpl::gamma_distribution<result_type>;
+    using gamma_distr_param_type = typename gamma_distr::param_type;
+
+    // Static asserts
+    static_assert(::std::is_floating_point_v<scalar_type>,
+                  "oneapi::dpl::chi_squared_distribution. Error: unsupported data type");
+
+    // Distribution parameters
+    gamma_distr gd_;
+};
+} // namespace dpl
+} // namespace oneapi
+
+#endif // _ONEDPL_CHI_SQUARED_DISTRIBUTION_H
@@ -141,6 +141,15 @@ class discard_block_engine
         return generate_internal<internal::type_traits_t<result_type>::num_elems>(__random_nums);
     }
 
+    // Fill the range with the values of consecutive operator () calls
+    template <class _ForwardIt>
+    void
+    generate(_ForwardIt __first, _ForwardIt __last)
+    {
+        for (; __first != __last; ++__first)
+            *__first = operator()();
+    }
+
     // Property function
     const _Engine&
     base() const noexcept
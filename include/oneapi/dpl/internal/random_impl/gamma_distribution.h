@@ -0,0 +1,343 @@
+// -*- C++ -*-
+//===-- gamma_distribution.h ----------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// This file incorporates work covered by the following copyright and permission
+// notice:
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+//
+//===----------------------------------------------------------------------===//
+//
+// Abstract:
+//
+// Public header file provides implementation for Gamma Distribution
+
+#ifndef _ONEDPL_GAMMA_DISTRIBUTION_H
+#define _ONEDPL_GAMMA_DISTRIBUTION_H
+
+namespace oneapi
+{
+namespace dpl
+{
+template <class _RealType = double>
+class gamma_distribution
+{
+  public:
+    // Distribution types
+    using result_type = _RealType;
+    using scalar_type = internal::element_type_t<_RealType>;
+    class param_type
+    {
+      public:
+        using distribution_type = gamma_distribution<result_type>;
+        param_type() : param_type(scalar_type{1.0}) {}
+        explicit param_type(scalar_type alpha, scalar_type beta = scalar_type{1.0}) : alpha_(alpha), beta_(beta) {}
+        scalar_type
+        alpha() const
+        {
+            return alpha_;
+        }
+        scalar_type
+        beta() const
+        {
+            return beta_;
+        }
+        friend bool
+        operator==(const param_type& p1, const param_type& p2)
+        {
+            return p1.alpha_ == p2.alpha_ && p1.beta_ == p2.beta_;
+        }
+        friend bool
+        operator!=(const param_type& p1, const param_type& p2)
+        {
+            return !(p1 == p2);
+        }
+
+      private:
+        scalar_type alpha_;
+        scalar_type beta_;
+    };
+
+    // Constructors
+    gamma_distribution() : gamma_distribution(scalar_type{1.0}) {}
+    explicit gamma_distribution(scalar_type __alpha, scalar_type __beta = scalar_type{1.0})
+        : alpha_(__alpha), beta_(__beta)
+    {
+    }
+    explicit gamma_distribution(const param_type& __params) : alpha_(__params.alpha()), beta_(__params.beta()) {}
+
+    // Reset function
+    void
+    reset()
+    {
+        nd_.reset();
+    }
+
+    // Property functions
+    scalar_type
+    alpha() const
+    {
+        return alpha_;
+    }
+
+    scalar_type
+    beta() const
+    {
+        return beta_;
+    }
+
+    param_type
+    param() const
+    {
+        return param_type(alpha_, beta_);
+    }
+
+    void
+    param(const param_type& __params)
+    {
+        alpha_ = __params.alpha();
+        beta_ = __params.beta();
+    }
+
+    scalar_type
+    min() const
+    {
+        return scalar_type{};
+    }
+
+    scalar_type
+    max() const
+    {
+        return ::std::numeric_limits<scalar_type>::max();
+    }
+
+    // Generate functions
+    template <class _Engine>
+    result_type
+    operator()(_Engine& __engine)
+    {
+        return operator()<_Engine>(__engine, param_type(alpha_, beta_));
+    }
+
+    template <class _Engine>
+    result_type
+    operator()(_Engine& __engine, const param_type& __params)
+    {
+        return generate<size_of_type_, _Engine>(__engine, __params);
+    }
+
+    template <class _Engine>
+    result_type
+    operator()(_Engine& __engine, unsigned int __random_nums)
+    {
+        return operator()<_Engine>(__engine, param_type(alpha_, beta_), __random_nums);
+    }
+
+    template <class _Engine>
+    result_type
+    operator()(_Engine& __engine, const param_type& __params, unsigned int __random_nums)
+    {
+        return result_portion_internal<size_of_type_, _Engine>(__engine, __params, __random_nums);
+    }
+
+    // Fill the range with the values of consecutive operator () calls
+    template <class _Engine, class _ForwardIt>
+    void
+    generate(_Engine& __engine, _ForwardIt __first, _ForwardIt __last)
+    {
+        generate<_Engine, _ForwardIt>(__engine, param(), __first, __last);
+    }
+
+    template <class _Engine, class _ForwardIt>
+    void
+    generate(_Engine& __engine, const param_type& __params, _ForwardIt __first, _ForwardIt __last)
+    {
+        if constexpr (size_of_type_ == 0)
+        {
+            const mt_constants __mt = make_mt_constants(__params.alpha());
+            for (; __first != __last; ++__first)
+                *__first = generate_scalar(__engine, __mt, __params.beta());
+        }
+        else
+        {
+            for (; __first != __last; ++__first)
+                *__first = operator()(__engine, __params);
+        }
+    }
+
+    friend bool
+    operator==(const gamma_distribution& __x, const gamma_distribution& __y)
+    {
+        return __x.param() == __y.param();
+    }
+
+    friend bool
+    operator!=(const gamma_distribution& __x, const gamma_distribution& __y)
+    {
+        return !(__x == __y);
+    }
+
+    template <class CharT, class Traits>
+    friend ::std::basic_ostream<CharT, Traits>&
+    operator<<(::std::basic_ostream<CharT, Traits>& __os, const gamma_distribution& __d)
+    {
+        internal::save_stream_flags<CharT, Traits> __flags(__os);
+
+        __os.setf(std::ios_base::dec | std::ios_base::left);
+        CharT __sp = __os.widen(' ');
+        __os.fill(__sp);
+
+        return __os << __d.alpha() << __sp << __d.beta();
+    }
+
+    friend const sycl::stream&
+    operator<<(const sycl::stream& __os, const gamma_distribution& __d)
+    {
+        return __os << __d.alpha() << ' ' << __d.beta();
+    }
+
+    template <class CharT, class Traits>
+    friend ::std::basic_istream<CharT, Traits>&
+    operator>>(::std::basic_istream<CharT, Traits>& __is, gamma_distribution& __d)
+    {
+        internal::save_stream_flags<CharT, Traits> __flags(__is);
+
+        __is.setf(std::ios_base::dec);
+
+        scalar_type __alpha;
+        scalar_type __beta;
+
+        if (__is >> __alpha >> __beta)
+            __d.param(gamma_distribution::param_type(__alpha, __beta));
+
+        return __is;
+    }
+
+  private:
+    // Size of type
+    static constexpr int size_of_type_ = internal::type_traits_t<result_type>::num_elems;
+
+    // Static asserts
+    static_assert(::std::is_floating_point_v<scalar_type>,
+                  "oneapi::dpl::gamma_distribution. Error: unsupported data type");
+
+    // Distribution parameters
+    scalar_type alpha_;
+    scalar_type beta_;
+
+    // Normal distribution for the Marsaglia-Tsang method
+    oneapi::dpl::normal_distribution<scalar_type> nd_;
+
+    // Constants of the Marsaglia-Tsang method, computed once per call and shared by all the elements of a vector
+    // or of a generated range
+    struct mt_constants
+    {
+        scalar_type d;
+        scalar_type c;
+        scalar_type inv_alpha; // the exponent of the boost for alpha < 1, zero otherwise
+    };
+
+    static mt_constants
+    make_mt_constants(scalar_type __alpha)
+    {
+        mt_constants __mt;
+        __mt.inv_alpha = scalar_type{0.0};
+
+        // Gamma(alpha) = Gamma(alpha + 1) * U^(1 / alpha) for alpha < 1
+        if (__alpha < scalar_type{1.0})
+        {
+            __mt.inv_alpha = scalar_type{1.0} / __alpha;
+            __alpha += scalar_type{1.0};
+        }
+        __mt.d = __alpha - scalar_type{1.0} / scalar_type{3.0};
+        __mt.c = scalar_type{1.0} / sycl::sqrt(scalar_type{9.0} * __mt.d);
+        return __mt;
+    }
+
+    // Implementation for generate function
+    template <int _Ndistr, class _Engine>
+    ::std::enable_if_t<(_Ndistr != 0), result_type>
+    generate(_Engine& __engine, const param_type& __params)
+    {
+        return generate_n_elems<_Engine>(__engine, __params, _Ndistr);
+    }
+
+    // Specialization of the scalar generation
+    template <int _Ndistr, class _Engine>
+    ::std::enable_if_t<(_Ndistr == 0), result_type>
+    generate(_Engine& __engine, const param_type& __params)
+    {
+        return generate_scalar<_Engine>(__engine, make_mt_constants(__params.alpha()), __params.beta());
+    }
+
+    // Marsaglia-Tsang method: the rejection loop has no tables and no data-dependent setup,
+    // so each element of a vector is generated independently with the same instruction stream
+    template <class _Engine>
+    scalar_type
+    generate_scalar(_Engine& __engine, const mt_constants& __mt, scalar_type __beta)
+    {
+        oneapi::dpl::uniform_real_distribution<scalar_type> __u;
+        scalar_type __boost = scalar_type{1.0};
+        if (__mt.inv_alpha != scalar_type{0.0})
+            __boost = sycl::pow(scalar_type{1.0} - __u(__engine), __mt.inv_alpha);
+
+        scalar_type __v;
+        while (true)
+        {
+            scalar_type __x;
+            do
+            {
+                __x = nd_(__engine);
+                __v = scalar_type{1.0} + __mt.c * __x;
+            } while (__v <= scalar_type{0.0});
+
+            __v = __v * __v * __v;
+            const scalar_type __x2 = __x * __x;
+            const scalar_type __uv = __u(__engine);
+
+            // Squeeze check first, then the exact acceptance check
+            if (__uv < scalar_type{1.0} - scalar_type{0.0331} * __x2 * __x2)
+                break;
+            if (sycl::log(__uv) < scalar_type{0.5} * __x2 + __mt.d * (scalar_type{1.0} - __v + sycl::log(__v)))
+                break;
+        }
+
+        return __mt.d * __v * __boost * __beta;
+    }
+
+    // Implementation for the N vector's elements generation
+    template <class _Engine>
+    result_type
+    generate_n_elems(_Engine& __engine, const param_type& __params, unsigned int __N)
+    {
+        result_type __res;
+        const mt_constants __mt = make_mt_constants(__params.alpha());
+        for (unsigned int __i = 0; __i < __N; ++__i)
+            __res[__i] = generate_scalar<_Engine>(__engine, __mt, __params.beta());
+        return __res;
+    }
+
+    // Implementation for result_portion function
+    template <int _Ndistr, class _Engine>
+    ::std::enable_if_t<(_Ndistr != 0), result_type>
+    result_portion_internal(_Engine& __engine, const param_type& __params, unsigned int __N)
+    {
+        result_type __part_vec;
+        if (__N == 0)
+            return __part_vec;
+        else if (__N >= _Ndistr)
+            return operator()(__engine, __params);
+
+        __part_vec = generate_n_elems(__engine, __params, __N);
+        return __part_vec;
+    }
+};
+} // namespace dpl
+} // namespace oneapi
+
+#endif // _ONEDPL_GAMMA_DISTRIBUTION_H
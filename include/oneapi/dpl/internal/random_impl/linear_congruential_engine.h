@@ -118,6 +118,14 @@ class linear_congruential_engine
         return result_portion_internal<internal::type_traits_t<result_type>::num_elems>(__random_nums);
     }
 
+    // Fill the range with the values of consecutive operator () calls
+    template <class _ForwardIt>
+    void
+    generate(_ForwardIt __first, _ForwardIt __last)
+    {
+        generate_range_internal<internal::type_traits_t<result_type>::num_elems>(__first, __last);
+    }
+
     friend bool
     operator==(const linear_congruential_engine& __x, const linear_congruential_engine& __y)
     {
@@ -297,6 +305,38 @@ class linear_congruential_engine
         return __part_vec;
     }
 
+    // Range generation: the recurrence is advanced one step at a time on a local copy of the state
+    template <int _N, class _ForwardIt>
+    ::std::enable_if_t<(_N == 0)>
+    generate_range_internal(_ForwardIt __first, _ForwardIt __last)
+    {
+        scalar_type __state = state_;
+        for (; __first != __last; ++__first)
+        {
+            *__first = __state;
+            __state = mod_scalar(__state);
+        }
+        state_ = __state;
+    }
+
+    template <int _N, class _ForwardIt>
+    ::std::enable_if_t<(_N > 0)>
+    generate_range_internal(_ForwardIt __first, _ForwardIt __last)
+    {
+        result_type __state = state_;
+        scalar_type __prev = __state[_N - 1];
+        for (; __first != __last; ++__first)
+        {
+            *__first = __state;
+            for (int __i = 0; __i < _N; ++__i)
+            {
+                __prev = mod_scalar(__prev);
+                __state[__i] = __prev;
+            }
+        }
+        state_ = __state;
+    }
+
     result_type state_;
 };
 
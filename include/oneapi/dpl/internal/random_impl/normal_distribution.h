@@ -160,6 +160,21 @@ class normal_distribution
         return result_portion_internal<size_of_type_, _Engine>(__engine, __params, __random_nums);
     }
 
+    // Fill the range with the values of consecutive operator () calls
+    template <class _Engine, class _ForwardIt>
+    void
+    generate(_Engine& __engine, _ForwardIt __first, _ForwardIt __last)
+    {
+        generate<_Engine, _ForwardIt>(__engine, param(), __first, __last);
+    }
+
+    template <class _Engine, class _ForwardIt>
+    void
+    generate(_Engine& __engine, const param_type& __params, _ForwardIt __first, _ForwardIt __last)
+    {
+        generate_range_internal<size_of_type_, _Engine>(__engine, __params, __first, __last);
+    }
+
     friend bool
     operator==(const normal_distribution& __x, const normal_distribution& __y)
     {
@@ -473,6 +488,52 @@ class normal_distribution
         return __res;
     }
 
+    // Implementation for the range generation
+    template <int _Ndistr, class _Engine, class _ForwardIt>
+    ::std::enable_if_t<(_Ndistr != 0)>
+    generate_range_internal(_Engine& __engine, const param_type& __params, _ForwardIt __first, _ForwardIt __last)
+    {
+        for (; __first != __last; ++__first)
+            *__first = generate<_Ndistr, _Engine>(__engine, __params);
+    }
+
+    // Specialization of the scalar range generation: both values of each Box-Muller pair are written
+    // at once, so the saved value is only used at the range boundaries
+    template <int _Ndistr, class _Engine, class _ForwardIt>
+    ::std::enable_if_t<(_Ndistr == 0)>
+    generate_range_internal(_Engine& __engine, const param_type& __params, _ForwardIt __first, _ForwardIt __last)
+    {
+        if (__first != __last && flag_)
+        {
+            *__first = generate<_Ndistr, _Engine>(__engine, __params);
+            ++__first;
+        }
+
+        scalar_type __mean = __params.mean(), __stddev = __params.stddev();
+        const uniform_real_distr_param_type __unit_params(scalar_type{0.0}, scalar_type{1.0});
+
+        while (__first != __last)
+        {
+            _ForwardIt __second = ::std::next(__first);
+            if (__second == __last)
+            {
+                // the cosine value is saved for the next call
+                *__first = generate<_Ndistr, _Engine>(__engine, __params);
+                return;
+            }
+
+            scalar_type __u1 = uniform_real_distribution_(__engine, __unit_params);
+            scalar_type __u2 = uniform_real_distribution_(__engine, __unit_params);
+
+            scalar_type __ln = (__u1 == scalar_type{0.0}) ? callback<scalar_type>() : sycl::log(__u1);
+            scalar_type __r = sycl::sqrt(-scalar_type{2.0} * __ln);
+
+            *__first = __mean + __stddev * (__r * sycl::sin(pi2<scalar_type>() * __u2));
+            *__second = __mean + __stddev * (__r * sycl::cos(pi2<scalar_type>() * __u2));
+            __first = ::std::next(__second);
+        }
+    }
+
     // Implementation for result_portion function
     template <int _Ndistr, class _Engine>
     ::std::enable_if_t<(_Ndistr != 0), result_type>
@@ -150,6 +150,14 @@ class philox_engine
         return generate_internal<oneapi::dpl::internal::type_traits_t<result_type>::num_elems>(__random_nums);
     }
 
+    /* Fill the range with the values of consecutive operator () calls */
+    template <typename _ForwardIt>
+    void
+    generate(_ForwardIt __first, _ForwardIt __last)
+    {
+        generate_range_internal<oneapi::dpl::internal::type_traits_t<result_type>::num_elems>(__first, __last);
+    }
+
     /* Shift the counter only forward relative to its current position */
     void
     discard(unsigned long long __z)
@@ -331,6 +339,45 @@ class philox_engine
         return state_.Y[state_.idx];
     }
 
+    /* generate_range_internal() specified for sycl_vec output */
+    template <unsigned int _N, typename _ForwardIt>
+    std::enable_if_t<(_N > 0)>
+    generate_range_internal(_ForwardIt __first, _ForwardIt __last)
+    {
+        for (; __first != __last; ++__first)
+        {
+            *__first = generate_internal<_N>();
+        }
+    }
+
+    /* generate_range_internal() specified for a scalar output:
+       whole blocks are written straight from the kernel results, bypassing the buffer index */
+    template <unsigned int _N, typename _ForwardIt>
+    std::enable_if_t<(_N == 0)>
+    generate_range_internal(_ForwardIt __first, _ForwardIt __last)
+    {
+        // use up the results left in the buffer
+        for (; __first != __last && state_.idx != word_count - 1; ++__first)
+        {
+            *__first = generate_internal<_N>();
+        }
+
+        for (std::size_t __n = std::distance(__first, __last); __n >= word_count; __n -= word_count)
+        {
+            philox_kernel();
+            increase_counter_internal();
+            for (std::size_t __i = 0; __i < word_count; ++__i, ++__first)
+            {
+                *__first = state_.Y[__i];
+            }
+        }
+
+        for (; __first != __last; ++__first)
+        {
+            *__first = generate_internal<_N>();
+        }
+    }
+
     void
     discard_internal(unsigned long long __z)
     {
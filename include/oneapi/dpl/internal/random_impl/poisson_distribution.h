@@ -0,0 +1,327 @@
+// -*- C++ -*-
+//===-- poisson_distribution.h --------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// This file incorporates work covered by the following copyright and permission
+// notice:
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+//
+//===----------------------------------------------------------------------===//
+//
+// Abstract:
+//
+// Public header file provides implementation for Poisson Distribution
+
+#ifndef _ONEDPL_POISSON_DISTRIBUTION_H
+#define _ONEDPL_POISSON_DISTRIBUTION_H
+
+namespace oneapi
+{
+namespace dpl
+{
+template <class _IntType = int>
+class poisson_distribution
+{
+  public:
+    // Distribution types
+    using result_type = _IntType;
+    using scalar_type = internal::element_type_t<_IntType>;
+    class param_type
+    {
+      public:
+        using distribution_type = poisson_distribution<result_type>;
+        param_type() : param_type(1.0) {}
+        explicit param_type(double mean) : mean_(mean) {}
+        double
+        mean() const
+        {
+            return mean_;
+        }
+        friend bool
+        operator==(const param_type& p1, const param_type& p2)
+        {
+            return p1.mean_ == p2.mean_;
+        }
+        friend bool
+        operator!=(const param_type& p1, const param_type& p2)
+        {
+            return !(p1 == p2);
+        }
+
+      private:
+        double mean_;
+    };
+
+    // Constructors
+    poisson_distribution() : poisson_distribution(1.0) {}
+    explicit poisson_distribution(double __mean) : mean_(__mean) {}
+    explicit poisson_distribution(const param_type& __params) : mean_(__params.mean()) {}
+
+    // Reset function
+    void
+    reset()
+    {
+    }
+
+    // Property functions
+    double
+    mean() const
+    {
+        return mean_;
+    }
+
+    param_type
+    param() const
+    {
+        return param_type(mean_);
+    }
+
+    void
+    param(const param_type& __params)
+    {
+        mean_ = __params.mean();
+    }
+
+    scalar_type
+    min() const
+    {
+        return scalar_type{};
+    }
+
+    scalar_type
+    max() const
+    {
+        return ::std::numeric_limits<scalar_type>::max();
+    }
+
+    // Generate functions
+    template <class _Engine>
+    result_type
+    operator()(_Engine& __engine)
+    {
+        return operator()<_Engine>(__engine, param_type(mean_));
+    }
+
+    template <class _Engine>
+    result_type
+    operator()(_Engine& __engine, const param_type& __params)
+    {
+        return generate<size_of_type_, _Engine>(__engine, __params);
+    }
+
+    template <class _Engine>
+    result_type
+    operator()(_Engine& __engine, unsigned int __random_nums)
+    {
+        return operator()<_Engine>(__engine, param_type(mean_), __random_nums);
+    }
+
+    template <class _Engine>
+    result_type
+    operator()(_Engine& __engine, const param_type& __params, unsigned int __random_nums)
+    {
+        return result_portion_internal<size_of_type_, _Engine>(__engine, __params, __random_nums);
+    }
+
+    // Fill the range with the values of consecutive operator () calls
+    template <class _Engine, class _ForwardIt>
+    void
+    generate(_Engine& __engine, _ForwardIt __first, _ForwardIt __last)
+    {
+        generate<_Engine, _ForwardIt>(__engine, param(), __first, __last);
+    }
+
+    template <class _Engine, class _ForwardIt>
+    void
+    generate(_Engine& __engine, const param_type& __params, _ForwardIt __first, _ForwardIt __last)
+    {
+        for (; __first != __last; ++__first)
+            *__first = operator()(__engine, __params);
+    }
+
+    friend bool
+    operator==(const poisson_distribution& __x, const poisson_distribution& __y)
+    {
+        return __x.mean_ == __y.mean_;
+    }
+
+    friend bool
+    operator!=(const poisson_distribution& __x, const poisson_distribution& __y)
+    {
+        return !(__x == __y);
+    }
+
+    template <class CharT, class Traits>
+    friend ::std::basic_ostream<CharT, Traits>&
+    operator<<(::std::basic_ostream<CharT, Traits>& __os, const poisson_distribution& __d)
+    {
+        internal::save_stream_flags<CharT, Traits> __flags(__os);
+
+        __os.setf(std::ios_base::dec | std::ios_base::left);
+        __os.fill(__os.widen(' '));
+
+        return __os << __d.mean();
+    }
+
+    friend const sycl::stream&
+    operator<<(const sycl::stream& __os, const poisson_distribution& __d)
+    {
+        return __os << __d.mean();
+    }
+
+    template <class CharT, class Traits>
+    friend ::std::basic_istream<CharT, Traits>&
+    operator>>(::std::basic_istream<CharT, Traits>& __is, poisson_distribution& __d)
+    {
+        internal::save_stream_flags<CharT, Traits> __flags(__is);
+
+        __is.setf(std::ios_base::dec);
+
+        double __mean;
+        if (__is >> __mean)
+            __d.param(poisson_distribution::param_type(__mean));
+
+        return __is;
+    }
+
+  private:
+    // Size of type
+    static constexpr int size_of_type_ = internal::type_traits_t<result_type>::num_elems;
+
+    // Static asserts
+    static_assert(::std::is_integral_v<scalar_type>,
+                  "oneapi::dpl::poisson_distribution. Error: unsupported data type");
+
+    // Distribution parameters
+    double mean_;
+
+    // Below this mean the multiplication method is faster than the transformed rejection
+    static constexpr double ptrs_threshold_ = 10.0;
+
+    // Constants of the PTRS method, computed once per call and shared by all the vector elements
+    struct ptrs_constants
+    {
+        double log_mean;
+        double a;
+        double b;
+        double log_inv_alpha;
+        double v_r;
+    };
+
+    static ptrs_constants
+    make_ptrs_constants(double __mean)
+    {
+        ptrs_constants __c;
+        const double __smu = sycl::sqrt(__mean);
+        __c.log_mean = sycl::log(__mean);
+        __c.b = 0.931 + 2.53 * __smu;
+        __c.a = -0.059 + 0.02483 * __c.b;
+        __c.log_inv_alpha = sycl::log(1.1239 + 1.1328 / (__c.b - 3.4));
+        __c.v_r = 0.9277 - 3.6224 / (__c.b - 2.0);
+        return __c;
+    }
+
+    // Multiplication method for small mean values: __exp_neg_mean is exp(-mean)
+    template <class _Engine>
+    static scalar_type
+    generate_multiplication(_Engine& __engine, double __exp_neg_mean)
+    {
+        oneapi::dpl::uniform_real_distribution<double> __u;
+        scalar_type __k = 0;
+        double __prod = 1.0 - __u(__engine);
+        while (__prod > __exp_neg_mean)
+        {
+            ++__k;
+            __prod *= 1.0 - __u(__engine);
+        }
+        return __k;
+    }
+
+    // Transformed rejection with squeeze (PTRS, W. Hormann): a bounded number of scalar operations
+    // per attempt and no tables, so each element of a vector is generated independently
+    template <class _Engine>
+    static scalar_type
+    generate_ptrs(_Engine& __engine, double __mean, const ptrs_constants& __c)
+    {
+        oneapi::dpl::uniform_real_distribution<double> __u;
+        while (true)
+        {
+            const double __uu = __u(__engine) - 0.5;
+            const double __v = __u(__engine);
+            const double __us = 0.5 - sycl::fabs(__uu);
+            const double __k = sycl::floor((2.0 * __c.a / __us + __c.b) * __uu + __mean + 0.43);
+
+            if (__us >= 0.07 && __v <= __c.v_r)
+                return static_cast<scalar_type>(__k);
+            if (__k < 0.0 || (__us < 0.013 && __v > __us))
+                continue;
+            if (sycl::log(__v) + __c.log_inv_alpha - sycl::log(__c.a / (__us * __us) + __c.b) <=
+                -__mean + __k * __c.log_mean - sycl::lgamma(__k + 1.0))
+                return static_cast<scalar_type>(__k);
+        }
+    }
+
+    // Implementation for generate function
+    template <int _Ndistr, class _Engine>
+    ::std::enable_if_t<(_Ndistr != 0), result_type>
+    generate(_Engine& __engine, const param_type& __params)
+    {
+        return generate_n_elems<_Engine>(__engine, __params, _Ndistr);
+    }
+
+    // Specialization of the scalar generation
+    template <int _Ndistr, class _Engine>
+    ::std::enable_if_t<(_Ndistr == 0), result_type>
+    generate(_Engine& __engine, const param_type& __params)
+    {
+        if (__params.mean() < ptrs_threshold_)
+            return generate_multiplication(__engine, sycl::exp(-__params.mean()));
+        return generate_ptrs(__engine, __params.mean(), make_ptrs_constants(__params.mean()));
+    }
+
+    // Implementation for the N vector's elements generation
+    template <class _Engine>
+    result_type
+    generate_n_elems(_Engine& __engine, const param_type& __params, unsigned int __N)
+    {
+        result_type __res;
+        const double __mean = __params.mean();
+        if (__mean < ptrs_threshold_)
+        {
+            const double __exp_neg_mean = sycl::exp(-__mean);
+            for (unsigned int __i = 0; __i < __N; ++__i)
+                __res[__i] = generate_multiplication(__engine, __exp_neg_mean);
+        }
+        else
+        {
+            const ptrs_constants __c = make_ptrs_constants(__mean);
+            for (unsigned int __i = 0; __i < __N; ++__i)
+                __res[__i] = generate_ptrs(__engine, __mean, __c);
+        }
+        return __res;
+    }
+
+    // Implementation for result_portion function
+    template <int _Ndistr, class _Engine>
+    ::std::enable_if_t<(_Ndistr != 0), result_type>
+    result_portion_internal(_Engine& __engine, const param_type& __params, unsigned int __N)
+    {
+        result_type __part_vec;
+        if (__N == 0)
+            return __part_vec;
+        else if (__N >= _Ndistr)
+            return operator()(__engine, __params);
+
+        __part_vec = generate_n_elems(__engine, __params, __N);
+        return __part_vec;
+    }
+};
+} // namespace dpl
+} // namespace oneapi
+
+#endif // _ONEDPL_POISSON_DISTRIBUTION_H
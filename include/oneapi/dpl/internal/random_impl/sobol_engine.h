@@ -0,0 +1,427 @@
+// -*- C++ -*-
+//===-- sobol_engine.h ----------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// Abstract:
+//
+// Public header file provides implementation for Sobol quasi-random Engine
+
+#ifndef _ONEDPL_SOBOL_ENGINE_H
+#define _ONEDPL_SOBOL_ENGINE_H
+
+#include <cstdint>
+#include <type_traits>
+#include <limits>
+#include <array>
+#include <istream>
+#include <ostream>
+#include <algorithm>
+
+#include "random_common.h"
+
+namespace oneapi
+{
+namespace dpl
+{
+namespace internal
+{
+
+/* Primitive polynomials and initial direction numbers of S. Joe and F. Y. Kuo
+   ("Constructing Sobol sequences with better two-dimensional projections", 2008)
+   for the dimensions 2..21; the 1st dimension is the van der Corput sequence */
+struct sobol_polynomial
+{
+    std::uint32_t degree;       // s
+    std::uint32_t coefficients; // a - the inner coefficients of the polynomial
+    std::uint32_t initial_m[7]; // m_1..m_s
+};
+
+inline constexpr std::size_t sobol_max_dimensions = 21;
+
+inline constexpr sobol_polynomial sobol_polynomials[sobol_max_dimensions - 1] = {
+    {1, 0, {1}},
+    {2, 1, {1, 3}},
+    {3, 1, {1, 3, 1}},
+    {3, 2, {1, 1, 1}},
+    {4, 1, {1, 1, 3, 3}},
+    {4, 4, {1, 3, 5, 13}},
+    {5, 2, {1, 1, 5, 5, 17}},
+    {5, 4, {1, 1, 5, 5, 5}},
+    {5, 7, {1, 1, 7, 11, 19}},
+    {5, 11, {1, 1, 5, 1, 1}},
+    {5, 13, {1, 1, 1, 3, 11}},
+    {5, 14, {1, 3, 5, 5, 31}},
+    {6, 1, {1, 3, 3, 9, 7, 49}},
+    {6, 13, {1, 1, 1, 15, 21, 21}},
+    {6, 16, {1, 3, 1, 13, 27, 49}},
+    {6, 19, {1, 1, 1, 15, 7, 5}},
+    {6, 22, {1, 3, 1, 15, 13, 25}},
+    {6, 25, {1, 1, 5, 5, 19, 61}},
+    {7, 1, {1, 3, 7, 11, 23, 15, 103}},
+    {7, 4, {1, 3, 7, 13, 13, 15, 69}}};
+
+} // namespace internal
+
+namespace experimental
+{
+
+template <typename _UIntType, std::size_t _Dimensions>
+class sobol_engine;
+
+template <typename __CharT, typename __Traits, typename __UIntType, std::size_t __dims>
+std::basic_ostream<__CharT, __Traits>&
+operator<<(std::basic_ostream<__CharT, __Traits>&, const sobol_engine<__UIntType, __dims>&);
+
+template <typename __UIntType, std::size_t __dims>
+const sycl::stream&
+operator<<(const sycl::stream&, const sobol_engine<__UIntType, __dims>&);
+
+template <typename __CharT, typename __Traits, typename __UIntType, std::size_t __dims>
+std::basic_istream<__CharT, __Traits>&
+operator>>(std::basic_istream<__CharT, __Traits>&, sobol_engine<__UIntType, __dims>&);
+
+template <typename _UIntType, std::size_t _Dimensions>
+class sobol_engine
+{
+  public:
+    /* Types */
+    using result_type = _UIntType;
+    using scalar_type = oneapi::dpl::internal::element_type_t<result_type>;
+
+    /* Engine characteristics */
+    static constexpr std::size_t dimensions = _Dimensions;
+    static constexpr std::size_t max_dimensions = oneapi::dpl::internal::sobol_max_dimensions;
+    static constexpr std::size_t word_size = 32;
+
+    static_assert(_Dimensions > 0 && _Dimensions <= max_dimensions,
+                  "the number of dimensions must satisfy 0 < dimensions <= max_dimensions");
+    static_assert(std::is_unsigned_v<scalar_type>, "UIntType must be unsigned type or vector of unsigned types");
+    static_assert(std::numeric_limits<scalar_type>::digits >= word_size,
+                  "size of the scalar UIntType (in case of sycl::vec<T, N> the size of T) must be at least 32 bits");
+
+    static constexpr scalar_type
+    min()
+    {
+        return 0;
+    }
+
+    static constexpr scalar_type
+    max()
+    {
+        // equals to 2^32 - 1
+        return 0xFFFFFFFFu;
+    }
+
+    /* The default seed gives the unscrambled Sobol sequence */
+    static constexpr scalar_type default_seed = 0u;
+
+    /* Constructors */
+    sobol_engine() : sobol_engine(default_seed) {}
+
+    explicit sobol_engine(scalar_type __seed) { seed(__seed); }
+
+    /* Seeding function: a non-zero seed applies a random digital shift to each dimension,
+       which keeps the stratification properties of the sequence */
+    void
+    seed(scalar_type __seed = default_seed)
+    {
+        seed_internal(__seed);
+    }
+
+    /* Generating functions: the output is the sequence of points flattened dimension by dimension,
+       so the k-th value is the coordinate k % dimensions of the point k / dimensions */
+    result_type
+    operator()()
+    {
+        return generate_internal<oneapi::dpl::internal::type_traits_t<result_type>::num_elems>();
+    }
+
+    /* operator () overload for result portion generation */
+    result_type
+    operator()(unsigned int __random_nums)
+    {
+        return generate_internal<oneapi::dpl::internal::type_traits_t<result_type>::num_elems>(__random_nums);
+    }
+
+    /* Fill the range with the values of consecutive operator () calls */
+    template <typename _ForwardIt>
+    void
+    generate(_ForwardIt __first, _ForwardIt __last)
+    {
+        for (; __first != __last; ++__first)
+        {
+            *__first = operator()();
+        }
+    }
+
+    /* Move the position forward by __z values; the point is recomputed from its Gray code,
+       so the cost does not depend on __z */
+    void
+    discard(unsigned long long __z)
+    {
+        discard_internal(__z);
+    }
+
+    /* Equality operators */
+    friend bool
+    operator==(const sobol_engine& __x, const sobol_engine& __y)
+    {
+        return (__x.point_ == __y.point_ && __x.dim_ == __y.dim_ &&
+                std::equal(__x.x_.begin(), __x.x_.end(), __y.x_.begin()) &&
+                std::equal(__x.shift_.begin(), __x.shift_.end(), __y.shift_.begin()));
+    }
+
+    friend bool
+    operator!=(const sobol_engine& __x, const sobol_engine& __y)
+    {
+        return !(__x == __y);
+    }
+
+    /* Inserters and extractors */
+    template <typename __CharT, typename __Traits, typename __UIntType, std::size_t __dims>
+    friend std::basic_ostream<__CharT, __Traits>&
+    operator<<(std::basic_ostream<__CharT, __Traits>&, const sobol_engine<__UIntType, __dims>&);
+
+    template <typename __UIntType, std::size_t __dims>
+    friend const sycl::stream&
+    operator<<(const sycl::stream&, const sobol_engine<__UIntType, __dims>&);
+
+    template <typename __CharT, typename __Traits, typename __UIntType, std::size_t __dims>
+    friend std::basic_istream<__CharT, __Traits>&
+    operator>>(std::basic_istream<__CharT, __Traits>&, sobol_engine<__UIntType, __dims>&);
+
+  private:
+    using direction_array = std::array<std::array<std::uint32_t, word_size>, _Dimensions>;
+
+    /* Direction numbers V[d][k] = m_k / 2^k of the dimension d scaled to word_size bits */
+    static constexpr direction_array
+    make_direction_numbers()
+    {
+        direction_array __v{};
+        for (std::size_t __k = 0; __k < word_size; ++__k)
+        {
+            __v[0][__k] = std::uint32_t(1) << (word_size - 1 - __k);
+        }
+        for (std::size_t __d = 1; __d < _Dimensions; ++__d)
+        {
+            const oneapi::dpl::internal::sobol_polynomial& __p = oneapi::dpl::internal::sobol_polynomials[__d - 1];
+            const std::size_t __s = __p.degree;
+            for (std::size_t __k = 0; __k < __s; ++__k)
+            {
+                __v[__d][__k] = __p.initial_m[__k] << (word_size - 1 - __k);
+            }
+            // recurrence of the primitive polynomial
+            for (std::size_t __k = __s; __k < word_size; ++__k)
+            {
+                std::uint32_t __val = __v[__d][__k - __s] ^ (__v[__d][__k - __s] >> __s);
+                for (std::size_t __j = 1; __j < __s; ++__j)
+                {
+                    if ((__p.coefficients >> (__s - 1 - __j)) & 1u)
+                        __val ^= __v[__d][__k - __j];
+                }
+                __v[__d][__k] = __val;
+            }
+        }
+        return __v;
+    }
+
+    static constexpr direction_array direction_numbers = make_direction_numbers();
+
+    /* Internal generator state */
+    std::array<std::uint32_t, _Dimensions> x_;     // coordinates of the current point
+    std::array<std::uint32_t, _Dimensions> shift_; // digital shifts
+    unsigned long long point_;                     // index of the current point
+    std::size_t dim_;                              // next dimension of the current point
+
+    void
+    seed_internal(scalar_type __seed)
+    {
+        // SplitMix64 hash of the seed and the dimension index
+        for (std::size_t __d = 0; __d < _Dimensions; ++__d)
+        {
+            std::uint64_t __z = std::uint64_t(__seed) + (__d + 1) * 0x9E3779B97F4A7C15ull;
+            __z = (__z ^ (__z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            __z = (__z ^ (__z >> 27)) * 0x94D049BB133111EBull;
+            __z ^= __z >> 31;
+            shift_[__d] = __seed ? std::uint32_t(__z >> 32) : 0u;
+            x_[__d] = 0;
+        }
+        point_ = 0;
+        dim_ = 0;
+    }
+
+    /* Gray-code step from the point i to the point i + 1 */
+    void
+    next_point_internal()
+    {
+        ++point_;
+        // beyond 2^32 points the sequence does not get new direction numbers
+        std::size_t __k = std::min<std::size_t>(sycl::ctz(point_), word_size - 1);
+        for (std::size_t __d = 0; __d < _Dimensions; ++__d)
+        {
+            x_[__d] ^= direction_numbers[__d][__k];
+        }
+        dim_ = 0;
+    }
+
+    scalar_type
+    next_value_internal()
+    {
+        if (dim_ == _Dimensions)
+        {
+            next_point_internal();
+        }
+        const std::size_t __d = dim_++;
+        return x_[__d] ^ shift_[__d];
+    }
+
+    /* generate_internal() specified for sycl_vec output
+       and overload for result portion generation */
+    template <unsigned int _N>
+    std::enable_if_t<(_N > 0), result_type>
+    generate_internal(unsigned int __random_nums)
+    {
+        if (__random_nums >= _N)
+            return operator()();
+
+        result_type __loc_result;
+        for (int __elm_count = 0; __elm_count < __random_nums; ++__elm_count)
+        {
+            __loc_result[__elm_count] = next_value_internal();
+        }
+
+        return __loc_result;
+    }
+
+    /* generate_internal() specified for sycl_vec output */
+    template <unsigned int _N>
+    std::enable_if_t<(_N > 0), result_type>
+    generate_internal()
+    {
+        result_type __loc_result;
+        for (int __elm_count = 0; __elm_count < _N; ++__elm_count)
+        {
+            __loc_result[__elm_count] = next_value_internal();
+        }
+
+        return __loc_result;
+    }
+
+    /* generate_internal() specified for a scalar output */
+    template <unsigned int _N>
+    std::enable_if_t<(_N == 0), result_type>
+    generate_internal()
+    {
+        return next_value_internal();
+    }
+
+    void
+    discard_internal(unsigned long long __z)
+    {
+        const unsigned long long __available_in_point = _Dimensions - dim_;
+        if (__z <= __available_in_point)
+        {
+            dim_ += __z;
+            return;
+        }
+
+        __z -= __available_in_point;
+        point_ += (__z - 1) / _Dimensions + 1;
+        dim_ = (__z - 1) % _Dimensions + 1;
+
+        // the point i is the XOR of the direction numbers selected by the bits of its Gray code
+        const unsigned long long __gray = point_ ^ (point_ >> 1);
+        for (std::size_t __d = 0; __d < _Dimensions; ++__d)
+        {
+            std::uint32_t __x = 0;
+            for (std::size_t __k = 0; __k < word_size && (__gray >> __k); ++__k)
+            {
+                if ((__gray >> __k) & 1u)
+                    __x ^= direction_numbers[__d][__k];
+            }
+            x_[__d] = __x;
+        }
+    }
+};
+
+template <typename __CharT, typename __Traits, typename __UIntType, std::size_t __dims>
+std::basic_ostream<__CharT, __Traits>&
+operator<<(std::basic_ostream<__CharT, __Traits>& __os, const sobol_engine<__UIntType, __dims>& __engine)
+{
+    oneapi::dpl::internal::save_stream_flags<__CharT, __Traits> __flags(__os);
+
+    __os.setf(std::ios_base::dec | std::ios_base::left);
+    __CharT __sp = __os.widen(' ');
+    __os.fill(__sp);
+
+    for (auto __x_elm : __engine.x_)
+    {
+        __os << __x_elm << __sp;
+    }
+    for (auto __shift_elm : __engine.shift_)
+    {
+        __os << __shift_elm << __sp;
+    }
+    __os << __engine.point_ << __sp << __engine.dim_;
+
+    return __os;
+}
+
+template <typename __UIntType, std::size_t __dims>
+const sycl::stream&
+operator<<(const sycl::stream& __os, const sobol_engine<__UIntType, __dims>& __engine)
+{
+    for (auto __x_elm : __engine.x_)
+    {
+        __os << __x_elm << ' ';
+    }
+    for (auto __shift_elm : __engine.shift_)
+    {
+        __os << __shift_elm << ' ';
+    }
+    __os << __engine.point_ << ' ' << __engine.dim_;
+
+    return __os;
+}
+
+template <typename __CharT, typename __Traits, typename __UIntType, std::size_t __dims>
+std::basic_istream<__CharT, __Traits>&
+operator>>(std::basic_istream<__CharT, __Traits>& __is, sobol_engine<__UIntType, __dims>& __engine)
+{
+    oneapi::dpl::internal::save_stream_flags<__CharT, __Traits> __flags(__is);
+
+    __is.setf(std::ios_base::dec);
+
+    std::array<std::uint32_t, 2 * __dims> __tmp_inp;
+    for (std::size_t __i = 0; __i < 2 * __dims; ++__i)
+    {
+        __is >> __tmp_inp[__i];
+    }
+    unsigned long long __point;
+    std::size_t __dim;
+    __is >> __point >> __dim;
+
+    if (!__is.fail())
+    {
+        for (std::size_t __i = 0; __i < __dims; ++__i)
+        {
+            __engine.x_[__i] = __tmp_inp[__i];
+            __engine.shift_[__i] = __tmp_inp[__dims + __i];
+        }
+        __engine.point_ = __point;
+        __engine.dim_ = __dim;
+    }
+
+    return __is;
+}
+
+} // namespace experimental
+} // namespace dpl
+} // namespace oneapi
+
+#endif //_ONEDPL_SOBOL_ENGINE_H
@@ -109,6 +109,15 @@ class subtract_with_carry_engine
         return result_portion_internal<internal::type_traits_t<result_type>::num_elems>(__random_nums);
     }
 
+    // Fill the range with the values of consecutive operator () calls
+    template <class _ForwardIt>
+    void
+    generate(_ForwardIt __first, _ForwardIt __last)
+    {
+        for (; __first != __last; ++__first)
+            *__first = operator()();
+    }
+
     friend bool
     operator==(const subtract_with_carry_engine& __x, const subtract_with_carry_engine& __y)
     {
@@ -146,6 +146,22 @@ class uniform_int_distribution
         return result_portion_internal<size_of_type_, _Engine>(__engine, __params, __random_nums);
     }
 
+    // Fill the range with the values of consecutive operator () calls
+    template <class _Engine, class _ForwardIt>
+    void
+    generate(_Engine& __engine, _ForwardIt __first, _ForwardIt __last)
+    {
+        generate<_Engine, _ForwardIt>(__engine, param(), __first, __last);
+    }
+
+    template <class _Engine, class _ForwardIt>
+    void
+    generate(_Engine& __engine, const param_type& __params, _ForwardIt __first, _ForwardIt __last)
+    {
+        for (; __first != __last; ++__first)
+            *__first = operator()(__engine, __params);
+    }
+
     friend bool
     operator==(const uniform_int_distribution& __x, const uniform_int_distribution& __y)
     {
@@ -198,8 +214,16 @@ class uniform_int_distribution
     // Size of type
     static constexpr int size_of_type_ = internal::type_traits_t<result_type>::num_elems;
 
-    // Type of real distribution
-    using RealType = ::std::conditional_t<size_of_type_ == 0, double, sycl::vec<double, size_of_type_>>;
+    // Unsigned type for the integer arithmetic
+    using UIntType = ::std::make_unsigned_t<scalar_type>;
+
+    // Type of the engine output element
+    template <class _Engine>
+    using engine_scalar_type = internal::element_type_t<typename _Engine::result_type>;
+
+    // Unsigned type which holds both the distribution range and the engine range
+    template <class _Engine>
+    using common_uint_type = ::std::common_type_t<UIntType, engine_scalar_type<_Engine>>;
 
     // Static asserts
     static_assert(::std::is_integral_v<scalar_type>,
@@ -209,34 +233,183 @@ class uniform_int_distribution
     scalar_type a_;
     scalar_type b_;
 
-    // Real distribution for the conversion
-    uniform_real_distribution<RealType> uniform_real_distribution_;
+    // Maximum number of the engine outputs combined for the ranges wider than the engine range
+    template <class _Engine>
+    static constexpr int
+    max_upscale_depth()
+    {
+        using _UCType = common_uint_type<_Engine>;
+        constexpr _UCType __erange = static_cast<_UCType>(_Engine::max()) - static_cast<_UCType>(_Engine::min());
+
+        int __depth = 0;
+        for (_UCType __top = ::std::numeric_limits<_UCType>::max(); __top > __erange; __top /= (__erange + 1))
+            ++__depth;
+        return __depth;
+    }
+
+    // Draws one more element of the engine output, is used for rejected values only
+    template <int _Nengine, class _Engine>
+    static common_uint_type<_Engine>
+    next_engine_value(_Engine& __engine)
+    {
+        using _UCType = common_uint_type<_Engine>;
+        if constexpr (_Nengine == 0)
+            return static_cast<_UCType>(__engine()) - static_cast<_UCType>(_Engine::min());
+        else
+            return static_cast<_UCType>(__engine(1)[0]) - static_cast<_UCType>(_Engine::min());
+    }
+
+    // Lemire's multiply-shift with rejection: __x is uniform on [0, 2^w), the result is uniform on [0, __s)
+    template <typename _WordT, int _Nengine, class _Engine>
+    static _WordT
+    multiply_shift(_WordT __x, _WordT __s, _Engine& __engine)
+    {
+        _WordT __low = __x * __s;
+        if (__low < __s)
+        {
+            const _WordT __threshold = static_cast<_WordT>(_WordT{0} - __s) % __s;
+            while (__low < __threshold)
+            {
+                __x = static_cast<_WordT>(next_engine_value<_Nengine>(__engine));
+                __low = __x * __s;
+            }
+        }
+        return sycl::mul_hi(__x, __s);
+    }
+
+    // Maps the engine output to [0, __urange] if the engine range is wider than __urange
+    template <int _Nengine, class _Engine>
+    static common_uint_type<_Engine>
+    downscale(common_uint_type<_Engine> __u, _Engine& __engine, common_uint_type<_Engine> __urange)
+    {
+        using _UCType = common_uint_type<_Engine>;
+        constexpr _UCType __erange = static_cast<_UCType>(_Engine::max()) - static_cast<_UCType>(_Engine::min());
+
+        if constexpr (__erange == ::std::numeric_limits<::std::uint32_t>::max())
+        {
+            return multiply_shift<::std::uint32_t, _Nengine>(static_cast<::std::uint32_t>(__u),
+                                                             static_cast<::std::uint32_t>(__urange) + 1u, __engine);
+        }
+        else if constexpr (__erange == ::std::numeric_limits<::std::uint64_t>::max())
+        {
+            return multiply_shift<::std::uint64_t, _Nengine>(static_cast<::std::uint64_t>(__u),
+                                                             static_cast<::std::uint64_t>(__urange) + 1u, __engine);
+        }
+        else
+        {
+            // The engine range is not a power of 2: reject the incomplete bucket and divide
+            const _UCType __uurange = __urange + 1;
+            const _UCType __scaling = (__erange + 1) / __uurange;
+            const _UCType __past = __uurange * __scaling;
+            while (__u >= __past)
+                __u = next_engine_value<_Nengine>(__engine);
+            return __u / __scaling;
+        }
+    }
+
+    // Maps the engine output to [0, __urange] if the engine range is narrower than __urange:
+    // the result is built from several engine outputs as digits in base (engine range + 1)
+    template <int _Nengine, class _Engine>
+    static common_uint_type<_Engine>
+    upscale(common_uint_type<_Engine> __u, _Engine& __engine, common_uint_type<_Engine> __urange)
+    {
+        using _UCType = common_uint_type<_Engine>;
+        constexpr _UCType __erange = static_cast<_UCType>(_Engine::max()) - static_cast<_UCType>(_Engine::min());
+        constexpr _UCType __uerange = __erange + 1;
+
+        // __limits[__i] is the upper bound of the value accumulated after (__i + 1) outer digits are dropped
+        _UCType __limits[max_upscale_depth<_Engine>()];
+        int __depth = 0;
+        _UCType __top = __urange;
+        for (; __top > __erange; __top /= __uerange)
+            __limits[__depth++] = __top;
+
+        while (true)
+        {
+            _UCType __ret = (__top == __erange) ? __u : downscale<_Nengine>(__u, __engine, __top);
+            int __i = __depth;
+            for (; __i > 0; --__i)
+            {
+                const _UCType __tmp = __uerange * __ret;
+                __ret = __tmp + next_engine_value<_Nengine>(__engine);
+                if (__ret > __limits[__i - 1] || __ret < __tmp)
+                    break;
+            }
+            if (__i == 0)
+                return __ret;
+            __u = next_engine_value<_Nengine>(__engine);
+        }
+    }
+
+    // Converts the engine output to the distribution value with integer arithmetic only
+    template <int _Nengine, class _Engine>
+    static scalar_type
+    make_int_uniform(engine_scalar_type<_Engine> __engine_output, _Engine& __engine, const param_type& __params)
+    {
+        using _UCType = common_uint_type<_Engine>;
+        constexpr _UCType __erange = static_cast<_UCType>(_Engine::max()) - static_cast<_UCType>(_Engine::min());
+
+        const _UCType __urange =
+            static_cast<UIntType>(static_cast<UIntType>(__params.b()) - static_cast<UIntType>(__params.a()));
+        _UCType __u = static_cast<_UCType>(__engine_output) - static_cast<_UCType>(_Engine::min());
+
+        if (__erange > __urange)
+            __u = downscale<_Nengine>(__u, __engine, __urange);
+        else if constexpr (__erange < ::std::numeric_limits<_UCType>::max())
+        {
+            if (__erange < __urange)
+                __u = upscale<_Nengine>(__u, __engine, __urange);
+        }
+
+        return static_cast<scalar_type>(
+            static_cast<UIntType>(static_cast<UIntType>(__params.a()) + static_cast<UIntType>(__u)));
+    }
 
     // Implementation for generate function
     template <int _Ndistr, class _Engine>
     ::std::enable_if_t<(_Ndistr != 0), result_type>
     generate(_Engine& __engine, const param_type& __params)
     {
-        RealType __res = uniform_real_distribution_(
-            __engine, typename uniform_real_distribution<RealType>::param_type(
-                          static_cast<double>(__params.a()), static_cast<double>(__params.b()) + 1.0));
-
-        result_type __res_ret;
-        for (int __i = 0; __i < _Ndistr; ++__i)
-            __res_ret[__i] = static_cast<scalar_type>(__res[__i]);
-
-        return __res_ret;
+        return generate_n_elems<_Engine>(__engine, __params, _Ndistr);
     }
 
     template <int _Ndistr, class _Engine>
     ::std::enable_if_t<(_Ndistr == 0), result_type>
     generate(_Engine& __engine, const param_type& __params)
     {
-        RealType __res = uniform_real_distribution_(
-            __engine, typename uniform_real_distribution<RealType>::param_type(
-                          static_cast<double>(__params.a()), static_cast<double>(__params.b()) + 1.0));
+        constexpr int __nengine = internal::type_traits_t<typename _Engine::result_type>::num_elems;
+        if constexpr (__nengine == 0)
+            return make_int_uniform<__nengine>(__engine(), __engine, __params);
+        else
+            return make_int_uniform<__nengine>(__engine(1)[0], __engine, __params);
+    }
 
-        return static_cast<scalar_type>(__res);
+    // Implementation for the N vector's elements generation: one engine output per element
+    // unless the value is rejected
+    template <class _Engine>
+    result_type
+    generate_n_elems(_Engine& __engine, const param_type& __params, unsigned int __N)
+    {
+        constexpr int __nengine = internal::type_traits_t<typename _Engine::result_type>::num_elems;
+        result_type __res{};
+
+        if constexpr (__nengine == 0)
+        {
+            for (unsigned int __i = 0; __i < __N; ++__i)
+                __res[__i] = make_int_uniform<__nengine>(__engine(), __engine, __params);
+        }
+        else
+        {
+            constexpr unsigned int __engine_size = __nengine;
+            for (unsigned int __i = 0; __i < __N; __i += __engine_size)
+            {
+                const unsigned int __n = (__N - __i < __engine_size) ? __N - __i : __engine_size;
+                auto __engine_output = (__n == __engine_size) ? __engine() : __engine(__n);
+                for (unsigned int __j = 0; __j < __n; ++__j)
+                    __res[__i + __j] = make_int_uniform<__nengine>(__engine_output[__j], __engine, __params);
+            }
+        }
+        return __res;
     }
 
     // Implementation for result_portion function
@@ -250,15 +423,7 @@ class uniform_int_distribution
         else if (__N >= _Ndistr)
             return operator()(__engine, __params);
 
-        RealType __res =
-            uniform_real_distribution_(__engine,
-                                       typename uniform_real_distribution<RealType>::param_type(
-                                           static_cast<double>(__params.a()), static_cast<double>(__params.b()) + 1.0),
-                                       __N);
-
-        for (unsigned int __i = 0; __i < __N; ++__i)
-            __part_vec[__i] = static_cast<scalar_type>(__res[__i]);
-
+        __part_vec = generate_n_elems<_Engine>(__engine, __params, __N);
         return __part_vec;
     }
 };
@@ -0,0 +1,296 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _ONEDPL_REDUCE_BY_KEY_UNSORTED_IMPL_H
+#define _ONEDPL_REDUCE_BY_KEY_UNSORTED_IMPL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "../pstl/parallel_backend.h"
+#include "../pstl/value_set_utils.h"
+#include "by_segment_extension_defs.h"
+#include "../pstl/utils.h"
+
+namespace oneapi
+{
+namespace dpl
+{
+namespace internal
+{
+
+template <typename Name>
+class ReduceByKeyUnsorted1;
+template <typename Name>
+class ReduceByKeyUnsorted2;
+template <typename Name>
+class ReduceByKeyUnsorted3;
+template <typename Name>
+class ReduceByKeyUnsorted4;
+
+// An open-addressing hash table with linear probing of the distinct keys and the reductions of their values.
+// The keys are kept in the order they were first added.
+template <typename _Key, typename _Value, typename BinaryPred, typename BinaryOperator>
+class __reduce_by_key_table
+{
+    std::vector<_Key> __keys_;
+    std::vector<_Value> __values_;
+    std::vector<std::size_t> __slots_; // the index of the key plus one, zero for an empty slot
+    std::size_t __slot_mask_ = 0;
+    int __slot_shift_ = 0;
+    std::size_t __size_hint_;
+    BinaryPred __pred_;
+    BinaryOperator __op_;
+    std::hash<_Key> __hash_;
+
+    std::size_t
+    __slot(const _Key& __k) const
+    {
+        // Fibonacci hashing spreads the identity hash of the integers over the table
+        return std::size_t((std::uint64_t(__hash_(__k)) * 0x9E3779B97F4A7C15ull) >> __slot_shift_);
+    }
+
+    // Keeps at most a half of the slots used, for at least the number of the distinct keys expected
+    void
+    __grow()
+    {
+        std::size_t __capacity = 16;
+        __slot_shift_ = 64 - 4;
+        while (__capacity < 2 * std::max(__keys_.size() + 1, __size_hint_))
+        {
+            __capacity *= 2;
+            --__slot_shift_;
+        }
+        __slot_mask_ = __capacity - 1;
+        __slots_.assign(__capacity, 0);
+
+        for (std::size_t __i = 0; __i < __keys_.size(); ++__i)
+        {
+            std::size_t __s = __slot(__keys_[__i]);
+            while (__slots_[__s] != 0)
+                __s = (__s + 1) & __slot_mask_;
+            __slots_[__s] = __i + 1;
+        }
+    }
+
+  public:
+    __reduce_by_key_table(BinaryPred __pred, BinaryOperator __op, std::size_t __size_hint)
+        : __size_hint_(__size_hint), __pred_(__pred), __op_(__op)
+    {
+    }
+
+    // Reduces the value into the one of the key, or adds the key with the value
+    template <typename _KeyArg, typename _ValueArg>
+    void
+    __add(_KeyArg&& __k, _ValueArg&& __v)
+    {
+        if (2 * (__keys_.size() + 1) > __slots_.size())
+            __grow();
+
+        std::size_t __s = __slot(__k);
+        for (; __slots_[__s] != 0; __s = (__s + 1) & __slot_mask_)
+        {
+            const std::size_t __i = __slots_[__s] - 1;
+            if (__pred_(__keys_[__i], __k))
+            {
+                __values_[__i] = __op_(__values_[__i], std::forward<_ValueArg>(__v));
+                return;
+            }
+        }
+        __slots_[__s] = __keys_.size() + 1;
+        __keys_.emplace_back(std::forward<_KeyArg>(__k));
+        __values_.emplace_back(std::forward<_ValueArg>(__v));
+    }
+
+    void
+    __merge(__reduce_by_key_table& __other)
+    {
+        for (std::size_t __i = 0; __i < __other.__size(); ++__i)
+            __add(std::move(__other.__keys_[__i]), std::move(__other.__values_[__i]));
+    }
+
+    std::size_t
+    __size() const
+    {
+        return __keys_.size();
+    }
+
+    template <typename OutputIterator1, typename OutputIterator2>
+    void
+    __write(std::size_t __i, OutputIterator1 result1, OutputIterator2 result2)
+    {
+        *result1 = std::move(__keys_[__i]);
+        *result2 = std::move(__values_[__i]);
+    }
+};
+
+template <typename InputIterator1, typename InputIterator2, typename BinaryPred, typename BinaryOperator>
+using __reduce_by_key_table_t =
+    __reduce_by_key_table<typename std::iterator_traits<InputIterator1>::value_type,
+                          typename std::iterator_traits<InputIterator2>::value_type, BinaryPred, BinaryOperator>;
+
+template <class _Tag, typename Policy, typename InputIterator1, typename InputIterator2, typename OutputIterator1,
+          typename OutputIterator2, typename BinaryPred, typename BinaryOperator>
+std::pair<OutputIterator1, OutputIterator2>
+pattern_reduce_by_key_unsorted(_Tag, Policy&&, InputIterator1 first1, InputIterator1 last1, InputIterator2 first2,
+                               OutputIterator1 result1, OutputIterator2 result2, BinaryPred binary_pred,
+                               BinaryOperator binary_op, std::size_t size_hint)
+{
+    static_assert(__internal::__is_host_dispatch_tag_v<_Tag>);
+    static_assert(__internal::__is_hashable<typename std::iterator_traits<InputIterator1>::value_type>::value,
+                  "reduce_by_key_unsorted requires std::hash of the keys");
+
+    // one pass over the elements adds the keys in the order of their first occurrences; the tables are not sized
+    // for more distinct keys than elements, the same as with the parallel policies
+    const std::size_t n = std::distance(first1, last1);
+    __reduce_by_key_table_t<InputIterator1, InputIterator2, BinaryPred, BinaryOperator> table(
+        binary_pred, binary_op, std::min(size_hint, n));
+    for (; first1 != last1; ++first1, ++first2)
+        table.__add(*first1, *first2);
+
+    for (std::size_t i = 0; i < table.__size(); ++i, ++result1, ++result2)
+        table.__write(i, result1, result2);
+    return std::make_pair(result1, result2);
+}
+
+template <class _IsVector, typename Policy, typename InputIterator1, typename InputIterator2,
+          typename OutputIterator1, typename OutputIterator2, typename BinaryPred, typename BinaryOperator>
+std::pair<OutputIterator1, OutputIterator2>
+pattern_reduce_by_key_unsorted(__internal::__parallel_tag<_IsVector>, Policy&& policy, InputIterator1 first1,
+                               InputIterator1 last1, InputIterator2 first2, OutputIterator1 result1,
+                               OutputIterator2 result2, BinaryPred binary_pred, BinaryOperator binary_op,
+                               std::size_t size_hint)
+{
+    static_assert(__internal::__is_hashable<typename std::iterator_traits<InputIterator1>::value_type>::value,
+                  "reduce_by_key_unsorted requires std::hash of the keys");
+
+    using __backend_tag = typename __internal::__parallel_tag<_IsVector>::__backend_tag;
+    using _Table = __reduce_by_key_table_t<InputIterator1, InputIterator2, BinaryPred, BinaryOperator>;
+    using _Size = typename std::iterator_traits<InputIterator1>::difference_type;
+
+    const _Size n = last1 - first1;
+    if (n <= 0)
+        return std::make_pair(result1, result2);
+
+    // each thread reduces the values of the keys in its own table, and the tables are merged in the end
+    auto tls =
+        __par_backend::__make_enumerable_tls<_Table>(binary_pred, binary_op, std::min(size_hint, std::size_t(n)));
+    __internal::__except_handler([&]() {
+        __par_backend::__parallel_for(__backend_tag{}, policy, _Size(0), n, [first1, first2, &tls](_Size i, _Size j) {
+            _Table& table = tls.get_for_current_thread();
+            for (; i < j; ++i)
+                table.__add(first1[i], first2[i]);
+        });
+    });
+
+    _Table& table = tls.get_with_id(0);
+    for (std::size_t t = 1; t < tls.size(); ++t)
+        table.__merge(tls.get_with_id(t));
+
+    // the order of the written keys depends on how the elements were divided between the threads
+    for (std::size_t i = 0; i < table.__size(); ++i, ++result1, ++result2)
+        table.__write(i, result1, result2);
+    return std::make_pair(result1, result2);
+}
+
+#if _ONEDPL_BACKEND_SYCL
+// The keys are sorted together with their values, and the runs of the equal keys are reduced, so the keys
+// are written in their sorted order
+template <typename _BackendTag, typename Policy, typename InputIterator1, typename InputIterator2,
+          typename OutputIterator1, typename OutputIterator2, typename BinaryPred, typename BinaryOperator>
+std::pair<OutputIterator1, OutputIterator2>
+pattern_reduce_by_key_unsorted(__internal::__hetero_tag<_BackendTag>, Policy&& policy, InputIterator1 first1,
+                               InputIterator1 last1, InputIterator2 first2, OutputIterator1 result1,
+                               OutputIterator2 result2, BinaryPred binary_pred, BinaryOperator binary_op, std::size_t)
+{
+    using _Key = typename std::iterator_traits<InputIterator1>::value_type;
+    using _Value = typename std::iterator_traits<InputIterator2>::value_type;
+
+    const auto n = last1 - first1;
+    if (n <= 0)
+        return std::make_pair(result1, result2);
+
+    oneapi::dpl::__par_backend_hetero::__buffer<Policy, _Key> _keys(policy, n);
+    oneapi::dpl::__par_backend_hetero::__buffer<Policy, _Value> _values(policy, n);
+
+    auto policy1 = oneapi::dpl::__par_backend_hetero::make_wrapped_policy<ReduceByKeyUnsorted1>(policy);
+    oneapi::dpl::copy(std::move(policy1), first1, last1, _keys.get());
+    auto policy2 = oneapi::dpl::__par_backend_hetero::make_wrapped_policy<ReduceByKeyUnsorted2>(policy);
+    oneapi::dpl::copy(std::move(policy2), first2, first2 + n, _values.get());
+
+    auto policy3 = oneapi::dpl::__par_backend_hetero::make_wrapped_policy<ReduceByKeyUnsorted3>(policy);
+    oneapi::dpl::sort_by_key(std::move(policy3), _keys.get(), _keys.get() + n, _values.get());
+
+    auto policy4 = oneapi::dpl::__par_backend_hetero::make_wrapped_policy<ReduceByKeyUnsorted4>(
+        std::forward<Policy>(policy));
+    return oneapi::dpl::reduce_by_segment(std::move(policy4), _keys.get(), _keys.get() + n, _values.get(), result1,
+                                          result2, binary_pred, binary_op);
+}
+#endif
+} // namespace internal
+
+// Writes each distinct key and the reduction of its values once. The order of the written pairs is unspecified,
+// and it differs between the host and the device policies.
+template <typename Policy, typename InputIterator1, typename InputIterator2, typename OutputIterator1,
+          typename OutputIterator2, typename BinaryPred, typename BinaryOperator>
+oneapi::dpl::__internal::__enable_if_execution_policy<Policy, std::pair<OutputIterator1, OutputIterator2>>
+reduce_by_key_unsorted(Policy&& policy, InputIterator1 first1, InputIterator1 last1, InputIterator2 first2,
+                       OutputIterator1 result1, OutputIterator2 result2, BinaryPred binary_pred,
+                       BinaryOperator binary_op, std::size_t size_hint)
+{
+    const auto __dispatch_tag = oneapi::dpl::__internal::__select_backend(policy, first1, first2, result1, result2);
+
+    return internal::pattern_reduce_by_key_unsorted(__dispatch_tag, std::forward<Policy>(policy), first1, last1,
+                                                    first2, result1, result2, binary_pred, binary_op, size_hint);
+}
+
+template <typename Policy, typename InputIterator1, typename InputIterator2, typename OutputIterator1,
+          typename OutputIterator2, typename BinaryPred, typename BinaryOperator>
+oneapi::dpl::__internal::__enable_if_execution_policy<Policy, std::pair<OutputIterator1, OutputIterator2>>
+reduce_by_key_unsorted(Policy&& policy, InputIterator1 first1, InputIterator1 last1, InputIterator2 first2,
+                       OutputIterator1 result1, OutputIterator2 result2, BinaryPred binary_pred,
+                       BinaryOperator binary_op)
+{
+    return oneapi::dpl::reduce_by_key_unsorted(std::forward<Policy>(policy), first1, last1, first2, result1, result2,
+                                               binary_pred, binary_op, std::size_t(0));
+}
+
+template <typename Policy, typename InputIterator1, typename InputIterator2, typename OutputIterator1,
+          typename OutputIterator2, typename BinaryPred>
+oneapi::dpl::__internal::__enable_if_execution_policy<Policy, std::pair<OutputIterator1, OutputIterator2>>
+reduce_by_key_unsorted(Policy&& policy, InputIterator1 first1, InputIterator1 last1, InputIterator2 first2,
+                       OutputIterator1 result1, OutputIterator2 result2, BinaryPred binary_pred)
+{
+    typedef typename std::iterator_traits<InputIterator2>::value_type T;
+
+    return oneapi::dpl::reduce_by_key_unsorted(std::forward<Policy>(policy), first1, last1, first2, result1, result2,
+                                               binary_pred, std::plus<T>());
+}
+
+template <typename Policy, typename InputIterator1, typename InputIterator2, typename OutputIterator1,
+          typename OutputIterator2>
+oneapi::dpl::__internal::__enable_if_execution_policy<Policy, std::pair<OutputIterator1, OutputIterator2>>
+reduce_by_key_unsorted(Policy&& policy, InputIterator1 first1, InputIterator1 last1, InputIterator2 first2,
+                       OutputIterator1 result1, OutputIterator2 result2)
+{
+    typedef typename std::iterator_traits<InputIterator1>::value_type T;
+
+    return oneapi::dpl::reduce_by_key_unsorted(std::forward<Policy>(policy), first1, last1, first2, result1, result2,
+                                               std::equal_to<T>());
+}
+
+} // end namespace dpl
+} // end namespace oneapi
+
+#endif // _ONEDPL_REDUCE_BY_KEY_UNSORTED_IMPL_H
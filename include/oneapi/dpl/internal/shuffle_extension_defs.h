@@ -0,0 +1,33 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _ONEDPL_SHUFFLE_EXTENSION_DEFS_H
+#define _ONEDPL_SHUFFLE_EXTENSION_DEFS_H
+
+#include "../pstl/onedpl_config.h"
+
+namespace oneapi
+{
+namespace dpl
+{
+
+template <typename Policy, typename RandomAccessIterator, typename UniformRandomBitGenerator>
+oneapi::dpl::__internal::__enable_if_execution_policy<Policy, void>
+shuffle(Policy&& policy, RandomAccessIterator first, RandomAccessIterator last, UniformRandomBitGenerator&& g);
+
+template <typename Policy, typename RandomAccessIterator, typename OutputIterator, typename Size,
+          typename UniformRandomBitGenerator>
+oneapi::dpl::__internal::__enable_if_execution_policy<Policy, OutputIterator>
+sample(Policy&& policy, RandomAccessIterator first, RandomAccessIterator last, OutputIterator result, Size n,
+       UniformRandomBitGenerator&& g);
+
+} // end namespace dpl
+} // end namespace oneapi
+
+#endif // _ONEDPL_SHUFFLE_EXTENSION_DEFS_H
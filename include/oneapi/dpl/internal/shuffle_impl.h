@@ -0,0 +1,294 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _ONEDPL_SHUFFLE_IMPL_H
+#define _ONEDPL_SHUFFLE_IMPL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../pstl/parallel_backend.h"
+#include "../pstl/iterator_impl.h"
+#include "shuffle_extension_defs.h"
+#include "../pstl/utils.h"
+
+namespace oneapi
+{
+namespace dpl
+{
+namespace internal
+{
+
+// Both algorithms order the elements by a random key computed from the seed and the element index only,
+// so the result does not depend on the number of threads or on the device.
+// The key is the SplitMix64 output for the index: a bijection of the index, hence the keys never collide
+// and the sort order is unique.
+struct __shuffle_key_fn
+{
+    std::uint64_t __seed;
+
+    std::uint64_t
+    operator()(std::uint64_t __idx) const
+    {
+        std::uint64_t __z = __seed + (__idx + 1) * 0x9E3779B97F4A7C15ull;
+        __z = (__z ^ (__z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        __z = (__z ^ (__z >> 27)) * 0x94D049BB133111EBull;
+        return __z ^ (__z >> 31);
+    }
+};
+
+// The generator is only used on the host to draw the seed, so any uniform random bit generator is accepted
+template <typename UniformRandomBitGenerator>
+std::uint64_t
+__make_shuffle_seed(UniformRandomBitGenerator& g)
+{
+    return std::uniform_int_distribution<std::uint64_t>{}(g);
+}
+
+template <typename Name>
+class Shuffle1;
+template <typename Name>
+class Shuffle2;
+template <typename Name>
+class Sample1;
+template <typename Name>
+class Sample2;
+template <typename Name>
+class Sample3;
+template <typename Name>
+class Sample4;
+
+template <class _Tag, typename Policy, typename RandomAccessIterator>
+void
+pattern_shuffle(_Tag, Policy&& policy, RandomAccessIterator first, RandomAccessIterator last, std::uint64_t seed)
+{
+    static_assert(__internal::__is_host_dispatch_tag_v<_Tag>);
+
+    const auto n = std::distance(first, last);
+    if (n <= 1)
+        return;
+
+    oneapi::dpl::__par_backend::__buffer<Policy, std::uint64_t> _keys(policy, n);
+    oneapi::dpl::transform(policy, oneapi::dpl::counting_iterator<std::uint64_t>(0),
+                           oneapi::dpl::counting_iterator<std::uint64_t>(n), _keys.get(), __shuffle_key_fn{seed});
+    oneapi::dpl::sort_by_key(std::forward<Policy>(policy), _keys.get(), _keys.get() + n, first);
+}
+
+// The indices with the k smallest keys among the ones added so far. At most 2k of them are kept: when the buffer
+// fills up, the k smallest are selected, and the keys above the k-th smallest one are not kept anymore, so the
+// memory is O(k) and each added index costs O(1) on average.
+class __sample_selection
+{
+    std::vector<std::pair<std::uint64_t, std::uint64_t>> __pairs_; // the keys with their indices
+    __shuffle_key_fn __key_;
+    std::size_t __k_;
+    std::uint64_t __threshold_ = std::numeric_limits<std::uint64_t>::max();
+
+    void
+    __shrink()
+    {
+        if (__pairs_.size() <= __k_)
+            return;
+        std::nth_element(__pairs_.begin(), __pairs_.begin() + (__k_ - 1), __pairs_.end());
+        __threshold_ = __pairs_[__k_ - 1].first;
+        __pairs_.resize(__k_);
+    }
+
+    void
+    __insert(std::uint64_t __key, std::uint64_t __idx)
+    {
+        // the keys are distinct, so a key above the threshold is never among the k smallest ones
+        if (__key > __threshold_)
+            return;
+        __pairs_.emplace_back(__key, __idx);
+        if (__pairs_.size() == 2 * __k_)
+            __shrink();
+    }
+
+  public:
+    __sample_selection(std::uint64_t __seed, std::size_t __k) : __key_{__seed}, __k_(__k) {}
+
+    void
+    __add(std::uint64_t __idx)
+    {
+        __insert(__key_(__idx), __idx);
+    }
+
+    void
+    __merge(const __sample_selection& __other)
+    {
+        for (const auto& __p : __other.__pairs_)
+            __insert(__p.first, __p.second);
+    }
+
+    // The indices of the k smallest keys in their original order; fewer if fewer keys were added
+    std::vector<std::uint64_t>
+    __indices()
+    {
+        __shrink();
+        std::vector<std::uint64_t> __result(__pairs_.size());
+        std::transform(__pairs_.begin(), __pairs_.end(), __result.begin(),
+                       [](const auto& __p) { return __p.second; });
+        std::sort(__result.begin(), __result.end());
+        return __result;
+    }
+};
+
+// Below this number of elements, the keys of sample are selected by one thread
+inline constexpr std::size_t __sample_cut_off = 10000;
+
+template <class _Tag, typename Policy, typename RandomAccessIterator, typename OutputIterator, typename Size>
+OutputIterator
+pattern_sample(_Tag, Policy&&, RandomAccessIterator first, RandomAccessIterator last, OutputIterator result,
+               Size count, std::uint64_t seed)
+{
+    static_assert(__internal::__is_host_dispatch_tag_v<_Tag>);
+
+    const auto n = std::distance(first, last);
+    const auto k = std::min<decltype(n)>(n, count);
+    if (k <= 0)
+        return result;
+
+    // the indices with the k smallest keys are selected and gathered in their original order
+    __sample_selection selection(seed, k);
+    for (std::uint64_t idx = 0; idx < std::uint64_t(n); ++idx)
+        selection.__add(idx);
+    for (std::uint64_t idx : selection.__indices())
+    {
+        *result = first[idx];
+        ++result;
+    }
+    return result;
+}
+
+template <class _IsVector, typename Policy, typename RandomAccessIterator, typename OutputIterator, typename Size>
+OutputIterator
+pattern_sample(__internal::__parallel_tag<_IsVector>, Policy&& policy, RandomAccessIterator first,
+               RandomAccessIterator last, OutputIterator result, Size count, std::uint64_t seed)
+{
+    using __backend_tag = typename __internal::__parallel_tag<_IsVector>::__backend_tag;
+    using _Size = typename std::iterator_traits<RandomAccessIterator>::difference_type;
+
+    const _Size n = last - first;
+    if (std::size_t(std::max<_Size>(n, 0)) < __sample_cut_off)
+        return pattern_sample(__internal::__serial_tag<_IsVector>{}, std::forward<Policy>(policy), first, last,
+                              result, count, seed);
+    const _Size k = std::min<_Size>(n, count);
+    if (k <= 0)
+        return result;
+
+    // each thread selects the k smallest keys of its elements, and the selections are merged in the end,
+    // so the memory is O(k) per thread rather than O(n)
+    auto tls = __par_backend::__make_enumerable_tls<__sample_selection>(seed, std::size_t(k));
+    __internal::__except_handler([&]() {
+        __par_backend::__parallel_for(__backend_tag{}, policy, _Size(0), n, [&tls](_Size i, _Size j) {
+            __sample_selection& selection = tls.get_for_current_thread();
+            for (; i < j; ++i)
+                selection.__add(i);
+        });
+    });
+
+    __sample_selection& selection = tls.get_with_id(0);
+    for (std::size_t t = 1; t < tls.size(); ++t)
+        selection.__merge(tls.get_with_id(t));
+
+    const std::vector<std::uint64_t> indices = selection.__indices();
+    auto gathered = oneapi::dpl::make_permutation_iterator(first, indices.begin());
+    return oneapi::dpl::copy(std::forward<Policy>(policy), gathered, gathered + k, result);
+}
+
+#if _ONEDPL_BACKEND_SYCL
+template <typename _BackendTag, typename Policy, typename RandomAccessIterator>
+void
+pattern_shuffle(__internal::__hetero_tag<_BackendTag>, Policy&& policy, RandomAccessIterator first,
+                RandomAccessIterator last, std::uint64_t seed)
+{
+    const auto n = std::distance(first, last);
+    if (n <= 1)
+        return;
+
+    oneapi::dpl::__par_backend_hetero::__buffer<Policy, std::uint64_t> _keys(policy, n);
+
+    auto policy1 = oneapi::dpl::__par_backend_hetero::make_wrapped_policy<Shuffle1>(policy);
+    oneapi::dpl::transform(std::move(policy1), oneapi::dpl::counting_iterator<std::uint64_t>(0),
+                           oneapi::dpl::counting_iterator<std::uint64_t>(n), _keys.get(), __shuffle_key_fn{seed});
+
+    auto policy2 = oneapi::dpl::__par_backend_hetero::make_wrapped_policy<Shuffle2>(std::forward<Policy>(policy));
+    oneapi::dpl::sort_by_key(std::move(policy2), _keys.get(), _keys.get() + n, first);
+}
+
+template <typename _BackendTag, typename Policy, typename RandomAccessIterator, typename OutputIterator,
+          typename Size>
+OutputIterator
+pattern_sample(__internal::__hetero_tag<_BackendTag>, Policy&& policy, RandomAccessIterator first,
+               RandomAccessIterator last, OutputIterator result, Size count, std::uint64_t seed)
+{
+    const auto n = std::distance(first, last);
+    const auto k = std::min<decltype(n)>(n, count);
+    if (k <= 0)
+        return result;
+
+    // the indices with the k smallest keys are selected and gathered in their original order
+    oneapi::dpl::__par_backend_hetero::__buffer<Policy, std::uint64_t> _keys(policy, n);
+    oneapi::dpl::__par_backend_hetero::__buffer<Policy, std::uint64_t> _indices(policy, n);
+
+    auto policy1 = oneapi::dpl::__par_backend_hetero::make_wrapped_policy<Sample1>(policy);
+    oneapi::dpl::transform(
+        std::move(policy1), oneapi::dpl::counting_iterator<std::uint64_t>(0),
+        oneapi::dpl::counting_iterator<std::uint64_t>(n),
+        oneapi::dpl::make_zip_iterator(_keys.get(), _indices.get()), [seed](std::uint64_t __idx) {
+            return oneapi::dpl::__internal::make_tuple(__shuffle_key_fn{seed}(__idx), __idx);
+        });
+
+    auto policy2 = oneapi::dpl::__par_backend_hetero::make_wrapped_policy<Sample2>(policy);
+    oneapi::dpl::sort_by_key(std::move(policy2), _keys.get(), _keys.get() + n, _indices.get());
+
+    auto policy3 = oneapi::dpl::__par_backend_hetero::make_wrapped_policy<Sample3>(policy);
+    oneapi::dpl::sort(std::move(policy3), _indices.get(), _indices.get() + k);
+
+    auto policy4 = oneapi::dpl::__par_backend_hetero::make_wrapped_policy<Sample4>(std::forward<Policy>(policy));
+    return oneapi::dpl::copy(std::move(policy4), oneapi::dpl::make_permutation_iterator(first, _indices.get()),
+                             oneapi::dpl::make_permutation_iterator(first, _indices.get()) + k, result);
+}
+#endif
+} // namespace internal
+
+template <typename Policy, typename RandomAccessIterator, typename UniformRandomBitGenerator>
+oneapi::dpl::__internal::__enable_if_execution_policy<Policy, void>
+shuffle(Policy&& policy, RandomAccessIterator first, RandomAccessIterator last, UniformRandomBitGenerator&& g)
+{
+    const auto __dispatch_tag = oneapi::dpl::__internal::__select_backend(policy, first);
+
+    internal::pattern_shuffle(__dispatch_tag, std::forward<Policy>(policy), first, last,
+                              internal::__make_shuffle_seed(g));
+}
+
+template <typename Policy, typename RandomAccessIterator, typename OutputIterator, typename Size,
+          typename UniformRandomBitGenerator>
+oneapi::dpl::__internal::__enable_if_execution_policy<Policy, OutputIterator>
+sample(Policy&& policy, RandomAccessIterator first, RandomAccessIterator last, OutputIterator result, Size n,
+       UniformRandomBitGenerator&& g)
+{
+    const auto __dispatch_tag = oneapi::dpl::__internal::__select_backend(policy, first, result);
+
+    return internal::pattern_sample(__dispatch_tag, std::forward<Policy>(policy), first, last, result, n,
+                                    internal::__make_shuffle_seed(g));
+}
+
+} // end namespace dpl
+} // end namespace oneapi
+
+#endif // _ONEDPL_SHUFFLE_IMPL_H
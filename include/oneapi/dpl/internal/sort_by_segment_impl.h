@@ -0,0 +1,160 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _ONEDPL_SORT_BY_SEGMENT_IMPL_H
+#define _ONEDPL_SORT_BY_SEGMENT_IMPL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+#include "../pstl/parallel_backend.h"
+#include "../pstl/iterator_impl.h"
+#include "by_segment_extension_defs.h"
+#include "binary_search_extension_defs.h"
+#include "../pstl/utils.h"
+
+namespace oneapi
+{
+namespace dpl
+{
+namespace internal
+{
+
+// The segments up to this size are sorted whole by one thread, many of them at a time; the larger ones one after
+// another with the parallel sort
+inline constexpr std::size_t __sort_by_segment_parallel_size = 1 << 14;
+
+template <typename Name>
+class SortBySegment1;
+template <typename Name>
+class SortBySegment2;
+
+template <class _Tag, typename Policy, typename RandomAccessIterator1, typename RandomAccessIterator2,
+          typename Compare>
+void
+pattern_sort_by_segment(_Tag, Policy&&, RandomAccessIterator1 keys_first, RandomAccessIterator1,
+                        RandomAccessIterator2 offsets_first, RandomAccessIterator2 offsets_last, Compare comp)
+{
+    static_assert(__internal::__is_host_dispatch_tag_v<_Tag>);
+
+    using _Size = typename std::iterator_traits<RandomAccessIterator2>::difference_type;
+
+    const _Size m = offsets_last - offsets_first - 1;
+    for (_Size s = 0; s < m; ++s)
+        std::sort(keys_first + offsets_first[s], keys_first + offsets_first[s + 1], comp);
+}
+
+template <class _IsVector, typename Policy, typename RandomAccessIterator1, typename RandomAccessIterator2,
+          typename Compare>
+void
+pattern_sort_by_segment(__internal::__parallel_tag<_IsVector>, Policy&& policy, RandomAccessIterator1 keys_first,
+                        RandomAccessIterator1, RandomAccessIterator2 offsets_first, RandomAccessIterator2 offsets_last,
+                        Compare comp)
+{
+    using __backend_tag = typename __internal::__parallel_tag<_IsVector>::__backend_tag;
+    using _Size = typename std::iterator_traits<RandomAccessIterator2>::difference_type;
+
+    const _Size m = offsets_last - offsets_first - 1;
+    if (m <= 0)
+        return;
+
+    auto is_large = [offsets_first](_Size s) {
+        return std::size_t(offsets_first[s + 1] - offsets_first[s]) > __sort_by_segment_parallel_size;
+    };
+
+    __internal::__except_handler([&]() {
+        __par_backend::__parallel_for(__backend_tag{}, policy, _Size(0), m, [=](_Size i, _Size j) {
+            for (; i < j; ++i)
+            {
+                if (!is_large(i))
+                    std::sort(keys_first + offsets_first[i], keys_first + offsets_first[i + 1], comp);
+            }
+        });
+    });
+
+    for (_Size s = 0; s < m; ++s)
+    {
+        if (is_large(s))
+            oneapi::dpl::sort(policy, keys_first + offsets_first[s], keys_first + offsets_first[s + 1], comp);
+    }
+}
+
+#if _ONEDPL_BACKEND_SYCL
+// Orders the pairs of the segment index and the key by the segment index first, and then by the key
+template <typename Compare>
+struct __segment_key_compare
+{
+    Compare comp;
+
+    template <typename _Tp1, typename _Tp2>
+    bool
+    operator()(const _Tp1& a, const _Tp2& b) const
+    {
+        using std::get;
+        return get<0>(a) < get<0>(b) || (get<0>(a) == get<0>(b) && comp(get<1>(a), get<1>(b)));
+    }
+};
+
+// The keys are sorted together with the index of their segment at once, so the segments of any size share
+// the work-groups of the device sort
+template <typename _BackendTag, typename Policy, typename RandomAccessIterator1, typename RandomAccessIterator2,
+          typename Compare>
+void
+pattern_sort_by_segment(__internal::__hetero_tag<_BackendTag>, Policy&& policy, RandomAccessIterator1 keys_first,
+                        RandomAccessIterator1 keys_last, RandomAccessIterator2 offsets_first,
+                        RandomAccessIterator2 offsets_last, Compare comp)
+{
+    using _Offset = typename std::iterator_traits<RandomAccessIterator2>::value_type;
+
+    const auto n = keys_last - keys_first;
+    const auto m = offsets_last - offsets_first - 1;
+    if (n <= 1 || m <= 0)
+        return;
+
+    // the index of the segment of a key is the number of the offsets after the first one not greater than its position
+    oneapi::dpl::__par_backend_hetero::__buffer<Policy, _Offset> _segments(policy, n);
+
+    auto policy1 = oneapi::dpl::__par_backend_hetero::make_wrapped_policy<SortBySegment1>(policy);
+    oneapi::dpl::upper_bound(std::move(policy1), offsets_first + 1, offsets_last,
+                             oneapi::dpl::counting_iterator<_Offset>(0), oneapi::dpl::counting_iterator<_Offset>(n),
+                             _segments.get());
+
+    auto policy2 = oneapi::dpl::__par_backend_hetero::make_wrapped_policy<SortBySegment2>(std::forward<Policy>(policy));
+    auto first = oneapi::dpl::make_zip_iterator(_segments.get(), keys_first);
+    oneapi::dpl::sort(std::move(policy2), first, first + n, __segment_key_compare<Compare>{comp});
+}
+#endif
+} // namespace internal
+
+template <typename Policy, typename RandomAccessIterator1, typename RandomAccessIterator2, typename Compare>
+oneapi::dpl::__internal::__enable_if_execution_policy<Policy, void>
+sort_by_segment(Policy&& policy, RandomAccessIterator1 keys_first, RandomAccessIterator1 keys_last,
+                RandomAccessIterator2 offsets_first, RandomAccessIterator2 offsets_last, Compare comp)
+{
+    const auto __dispatch_tag = oneapi::dpl::__internal::__select_backend(policy, keys_first, offsets_first);
+
+    internal::pattern_sort_by_segment(__dispatch_tag, std::forward<Policy>(policy), keys_first, keys_last,
+                                      offsets_first, offsets_last, comp);
+}
+
+template <typename Policy, typename RandomAccessIterator1, typename RandomAccessIterator2>
+oneapi::dpl::__internal::__enable_if_execution_policy<Policy, void>
+sort_by_segment(Policy&& policy, RandomAccessIterator1 keys_first, RandomAccessIterator1 keys_last,
+                RandomAccessIterator2 offsets_first, RandomAccessIterator2 offsets_last)
+{
+    oneapi::dpl::sort_by_segment(std::forward<Policy>(policy), keys_first, keys_last, offsets_first, offsets_last,
+                                 oneapi::dpl::__internal::__pstl_less());
+}
+
+} // end namespace dpl
+} // end namespace oneapi
+
+#endif // _ONEDPL_SORT_BY_SEGMENT_IMPL_H
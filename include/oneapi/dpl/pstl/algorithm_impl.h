@@ -22,6 +22,9 @@
 #include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <cstdint>
+#include <limits>
+#include <utility>
 
 #include "algorithm_fwd.h"
 
@@ -29,6 +32,8 @@
 #include "memory_impl.h"
 #include "parallel_backend_utils.h"
 #include "unseq_backend_simd.h"
+#include "value_set_utils.h"
+#include "searcher_utils.h"
 
 #include "parallel_backend.h"
 #include "parallel_impl.h"
@@ -109,7 +114,10 @@ template <class _ForwardIterator, class _Function>
 void
 __brick_walk1(_ForwardIterator __first, _ForwardIterator __last, _Function __f, /*vector=*/::std::false_type)
 {
-    ::std::for_each(__first, __last, __f);
+    if constexpr (__unseq_backend::__use_prefetched_walk_v<_ForwardIterator>)
+        __unseq_backend::__prefetched_walk(__last - __first, __f, __first);
+    else
+        ::std::for_each(__first, __last, __f);
 }
 
 template <class _RandomAccessIterator, class _Function>
@@ -273,9 +281,18 @@ _ForwardIterator2
 __brick_walk2(_ForwardIterator1 __first1, _ForwardIterator1 __last1, _ForwardIterator2 __first2, _Function __f,
               /*vector=*/::std::false_type) noexcept
 {
-    for (; __first1 != __last1; ++__first1, ++__first2)
-        __f(*__first1, *__first2);
-    return __first2;
+    if constexpr (__unseq_backend::__use_prefetched_walk_v<_ForwardIterator1, _ForwardIterator2>)
+    {
+        const auto __n = __last1 - __first1;
+        __unseq_backend::__prefetched_walk(__n, __f, __first1, __first2);
+        return __first2 + __n;
+    }
+    else
+    {
+        for (; __first1 != __last1; ++__first1, ++__first2)
+            __f(*__first1, *__first2);
+        return __first2;
+    }
 }
 
 template <class _RandomAccessIterator1, class _RandomAccessIterator2, class _Function>
@@ -479,9 +496,18 @@ _ForwardIterator3
 __brick_walk3(_ForwardIterator1 __first1, _ForwardIterator1 __last1, _ForwardIterator2 __first2,
               _ForwardIterator3 __first3, _Function __f, /*vector=*/::std::false_type) noexcept
 {
-    for (; __first1 != __last1; ++__first1, ++__first2, ++__first3)
-        __f(*__first1, *__first2, *__first3);
-    return __first3;
+    if constexpr (__unseq_backend::__use_prefetched_walk_v<_ForwardIterator1, _ForwardIterator2, _ForwardIterator3>)
+    {
+        const auto __n = __last1 - __first1;
+        __unseq_backend::__prefetched_walk(__n, __f, __first1, __first2, __first3);
+        return __first3 + __n;
+    }
+    else
+    {
+        for (; __first1 != __last1; ++__first1, ++__first2, ++__first3)
+            __f(*__first1, *__first2, *__first3);
+        return __first3;
+    }
 }
 
 template <class _RandomAccessIterator1, class _RandomAccessIterator2, class _RandomAccessIterator3, class _Function>
@@ -602,8 +628,16 @@ __brick_equal(_RandomAccessIterator1 __first1, _RandomAccessIterator1 __last1, _
     if (__last1 - __first1 != __last2 - __first2)
         return false;
 
-    return __unseq_backend::__simd_first(__first1, __last1 - __first1, __first2, __not_pred<_BinaryPredicate&>(__p))
-               .first == __last1;
+    if constexpr (__unseq_backend::__simd_kernel_mismatch_v<_RandomAccessIterator1, _RandomAccessIterator2,
+                                                            _BinaryPredicate>)
+        return __unseq_backend::__simd_kernel_mismatch(__first1, __last1 - __first1, __first2).first == __last1;
+    else if constexpr (__unseq_backend::__is_bytewise_equal_v<_RandomAccessIterator1, _RandomAccessIterator2,
+                                                              _BinaryPredicate>)
+        return __unseq_backend::__simd_equal_bytes(__first1, __last1 - __first1, __first2);
+    else
+        return __unseq_backend::__simd_first(__first1, __last1 - __first1, __first2,
+                                             __not_pred<_BinaryPredicate&>(__p))
+                   .first == __last1;
 }
 
 template <class _Tag, class _ExecutionPolicy, class _ForwardIterator1, class _ForwardIterator2, class _BinaryPredicate>
@@ -653,8 +687,16 @@ bool
 __brick_equal(_RandomAccessIterator1 __first1, _RandomAccessIterator1 __last1, _RandomAccessIterator2 __first2,
               _BinaryPredicate __p, /* is_vector = */ ::std::true_type) noexcept
 {
-    return __unseq_backend::__simd_first(__first1, __last1 - __first1, __first2, __not_pred<_BinaryPredicate&>(__p))
-               .first == __last1;
+    if constexpr (__unseq_backend::__simd_kernel_mismatch_v<_RandomAccessIterator1, _RandomAccessIterator2,
+                                                            _BinaryPredicate>)
+        return __unseq_backend::__simd_kernel_mismatch(__first1, __last1 - __first1, __first2).first == __last1;
+    else if constexpr (__unseq_backend::__is_bytewise_equal_v<_RandomAccessIterator1, _RandomAccessIterator2,
+                                                              _BinaryPredicate>)
+        return __unseq_backend::__simd_equal_bytes(__first1, __last1 - __first1, __first2);
+    else
+        return __unseq_backend::__simd_first(__first1, __last1 - __first1, __first2,
+                                             __not_pred<_BinaryPredicate&>(__p))
+                   .first == __last1;
 }
 
 template <class _Tag, class _ExecutionPolicy, class _ForwardIterator1, class _ForwardIterator2, class _BinaryPredicate>
@@ -699,9 +741,12 @@ __brick_find_if(_RandomAccessIterator __first, _RandomAccessIterator __last, _Pr
                 /*is_vector=*/::std::true_type) noexcept
 {
     typedef typename ::std::iterator_traits<_RandomAccessIterator>::difference_type _SizeType;
-    return __unseq_backend::__simd_first(
-        __first, _SizeType(0), __last - __first,
-        [&__pred](_RandomAccessIterator __it, _SizeType __i) { return __pred(__it[__i]); });
+    if constexpr (__unseq_backend::__simd_kernel_find_v<_RandomAccessIterator, _Predicate>)
+        return __unseq_backend::__simd_kernel_find(__first, __last - __first, __pred);
+    else
+        return __unseq_backend::__simd_first(
+            __first, _SizeType(0), __last - __first,
+            [&__pred](_RandomAccessIterator __it, _SizeType __i) { return __pred(__it[__i]); });
 }
 
 template <class _Tag, class _ExecutionPolicy, class _ForwardIterator, class _Predicate>
@@ -754,6 +799,17 @@ __find_subrange(_RandomAccessIterator1 __first, _RandomAccessIterator1 __last, _
         return __last;
     }
 
+    // long subsequences of integers are searched for with shifts past the positions that cannot match
+    if constexpr (__use_horspool_v<_RandomAccessIterator1, _RandomAccessIterator2, _BinaryPredicate>)
+    {
+        if (__n2 >= decltype(__n2)(__horspool_min_size))
+        {
+            const __horspool_searcher<_RandomAccessIterator2> __searcher(__s_first, __s_last, __b_first);
+            return __b_first ? __searcher.__find_first(__first, __last, __global_last)
+                             : __searcher.__find_last(__first, __last, __global_last);
+        }
+    }
+
     auto __cur = __last;
     while (__first != __last && (__global_last - __first >= __n2))
     {
@@ -837,6 +893,12 @@ _ForwardIterator1
 __brick_find_end(_ForwardIterator1 __first, _ForwardIterator1 __last, _ForwardIterator2 __s_first,
                  _ForwardIterator2 __s_last, _BinaryPredicate __pred, /*__is_vector=*/::std::false_type) noexcept
 {
+    if constexpr (__use_horspool_v<_ForwardIterator1, _ForwardIterator2, _BinaryPredicate>)
+    {
+        if (__s_last - __s_first >= decltype(__s_last - __s_first)(__horspool_min_size))
+            return __internal::__find_subrange(__first, __last, __last, __s_first, __s_last, __pred, false,
+                                               ::std::false_type());
+    }
     return ::std::find_end(__first, __last, __s_first, __s_last, __pred);
 }
 
@@ -907,10 +969,25 @@ __brick_find_first_of(_ForwardIterator1 __first, _ForwardIterator1 __last, _Forw
 template <class _Tag, class _ExecutionPolicy, class _ForwardIterator1, class _ForwardIterator2, class _BinaryPredicate>
 _ForwardIterator1
 __pattern_find_first_of(_Tag, _ExecutionPolicy&&, _ForwardIterator1 __first, _ForwardIterator1 __last,
-                        _ForwardIterator2 __s_first, _ForwardIterator2 __s_last, _BinaryPredicate __pred) noexcept
+                        _ForwardIterator2 __s_first, _ForwardIterator2 __s_last, _BinaryPredicate __pred)
 {
     static_assert(__is_serial_tag_v<_Tag> || __is_parallel_forward_tag_v<_Tag>);
 
+    // With many values to search for, each element is looked up in a set of them
+    if constexpr (__use_value_set_v<_ForwardIterator1, _ForwardIterator2, _BinaryPredicate>)
+    {
+        if (__first != __last && __use_value_set(::std::distance(__s_first, __s_last)))
+        {
+            return __internal::__except_handler([&]() {
+                using _Tp = typename ::std::iterator_traits<_ForwardIterator2>::value_type;
+                const __value_set<_Tp> __set(__s_first, __s_last);
+                return __internal::__brick_find_if(
+                    __first, __last, [&__set](const _Tp& __x) { return __set.__contains(__x); },
+                    typename _Tag::__is_vector{});
+            });
+        }
+    }
+
     return __internal::__brick_find_first_of(__first, __last, __s_first, __s_last, __pred,
                                              typename _Tag::__is_vector{});
 }
@@ -922,6 +999,25 @@ __pattern_find_first_of(__parallel_tag<_IsVector> __tag, _ExecutionPolicy&& __ex
                         _RandomAccessIterator1 __last, _RandomAccessIterator2 __s_first,
                         _RandomAccessIterator2 __s_last, _BinaryPredicate __pred)
 {
+    // With many values to search for, each element is looked up in a set of them, built once for all the chunks
+    if constexpr (__use_value_set_v<_RandomAccessIterator1, _RandomAccessIterator2, _BinaryPredicate>)
+    {
+        if (__first != __last && __use_value_set(__s_last - __s_first))
+        {
+            return __internal::__except_handler([&]() {
+                using _Tp = typename ::std::iterator_traits<_RandomAccessIterator2>::value_type;
+                const __value_set<_Tp> __set(__s_first, __s_last);
+                auto __contains = [&__set](const _Tp& __x) { return __set.__contains(__x); };
+                return __internal::__parallel_find(
+                    __tag, ::std::forward<_ExecutionPolicy>(__exec), __first, __last,
+                    [&__contains](_RandomAccessIterator1 __i, _RandomAccessIterator1 __j) {
+                        return __internal::__brick_find_if(__i, __j, __contains, _IsVector{});
+                    },
+                    ::std::true_type{});
+            });
+        }
+    }
+
     return __internal::__except_handler([&]() {
         return __internal::__parallel_find(
             __tag, ::std::forward<_ExecutionPolicy>(__exec), __first, __last,
@@ -940,6 +1036,12 @@ _ForwardIterator1
 __brick_search(_ForwardIterator1 __first, _ForwardIterator1 __last, _ForwardIterator2 __s_first,
                _ForwardIterator2 __s_last, _BinaryPredicate __pred, /*vector=*/::std::false_type) noexcept
 {
+    if constexpr (__use_horspool_v<_ForwardIterator1, _ForwardIterator2, _BinaryPredicate>)
+    {
+        if (__s_last - __s_first >= decltype(__s_last - __s_first)(__horspool_min_size))
+            return __internal::__find_subrange(__first, __last, __last, __s_first, __s_last, __pred, true,
+                                               ::std::false_type());
+    }
     return ::std::search(__first, __last, __s_first, __s_last, __pred);
 }
 
@@ -1059,9 +1161,12 @@ struct __brick_copy_n<_Tag, _ExecutionPolicy,
     operator()(_RandomAccessIterator1 __first, _Size __n, _RandomAccessIterator2 __result,
                /*vec*/ ::std::true_type) const
     {
-        return __unseq_backend::__simd_assign(
-            __first, __n, __result,
-            [](_RandomAccessIterator1 __first, _RandomAccessIterator2 __result) { *__result = *__first; });
+        if constexpr (__unseq_backend::__is_bytewise_copy_v<_RandomAccessIterator1, _RandomAccessIterator2>)
+            return __unseq_backend::__simd_copy_bytes(__first, __n, __result);
+        else
+            return __unseq_backend::__simd_assign(
+                __first, __n, __result,
+                [](_RandomAccessIterator1 __first, _RandomAccessIterator2 __result) { *__result = *__first; });
     }
 
     template <typename _Iterator, typename _Size, typename _OutputIterator>
@@ -1084,16 +1189,25 @@ struct __brick_copy<_Tag, _ExecutionPolicy, ::std::enable_if_t<__is_host_dispatc
     operator()(_RandomAccessIterator1 __first, _RandomAccessIterator1 __last, _RandomAccessIterator2 __result,
                /*vec*/ ::std::true_type) const
     {
-        return __unseq_backend::__simd_assign(
-            __first, __last - __first, __result,
-            [](_RandomAccessIterator1 __first, _RandomAccessIterator2 __result) { *__result = *__first; });
+        if constexpr (__unseq_backend::__is_bytewise_copy_v<_RandomAccessIterator1, _RandomAccessIterator2>)
+            return __unseq_backend::__simd_copy_bytes(__first, __last - __first, __result);
+        else if constexpr (__unseq_backend::__is_contiguous_permutation_v<_RandomAccessIterator1,
+                                                                           _RandomAccessIterator2>)
+            return __internal::__brick_walk2(__first, __last, __result, *this, ::std::true_type{});
+        else
+            return __unseq_backend::__simd_assign(
+                __first, __last - __first, __result,
+                [](_RandomAccessIterator1 __first, _RandomAccessIterator2 __result) { *__result = *__first; });
     }
 
     template <typename _Iterator, typename _OutputIterator>
     _OutputIterator
     operator()(_Iterator __first, _Iterator __last, _OutputIterator __result, /*vec*/ ::std::false_type) const
     {
-        return ::std::copy(__first, __last, __result);
+        if constexpr (__unseq_backend::__use_prefetched_walk_v<_Iterator, _OutputIterator>)
+            return __internal::__brick_walk2(__first, __last, __result, *this, ::std::false_type{});
+        else
+            return ::std::copy(__first, __last, __result);
     }
 
     template <typename _ReferenceType1, typename _ReferenceType2>
@@ -1116,9 +1230,13 @@ struct __brick_move<_Tag, _ExecutionPolicy, ::std::enable_if_t<__is_host_dispatc
     operator()(_RandomAccessIterator1 __first, _RandomAccessIterator1 __last, _RandomAccessIterator2 __result,
                /*vec*/ ::std::true_type) const
     {
-        return __unseq_backend::__simd_assign(
-            __first, __last - __first, __result,
-            [](_RandomAccessIterator1 __first, _RandomAccessIterator2 __result) { *__result = ::std::move(*__first); });
+        if constexpr (__unseq_backend::__is_bytewise_copy_v<_RandomAccessIterator1, _RandomAccessIterator2>)
+            return __unseq_backend::__simd_copy_bytes(__first, __last - __first, __result);
+        else
+            return __unseq_backend::__simd_assign(__first, __last - __first, __result,
+                                                  [](_RandomAccessIterator1 __first, _RandomAccessIterator2 __result) {
+                                                      *__result = ::std::move(*__first);
+                                                  });
     }
 
     template <typename _Iterator, typename _OutputIterator>
@@ -1206,10 +1324,15 @@ __brick_copy_if(_RandomAccessIterator1 __first, _RandomAccessIterator1 __last, _
                 _UnaryPredicate __pred,
                 /*vector=*/::std::true_type) noexcept
 {
+    if constexpr (__unseq_backend::__simd_kernel_compress_v<_RandomAccessIterator1, _RandomAccessIterator2>)
+        return __result + __unseq_backend::__simd_kernel_compress(
+                              __first, __last - __first, __result,
+                              [__first, &__pred](auto __i) -> bool { return __pred(__first[__i]); });
+    else
 #if (_PSTL_MONOTONIC_PRESENT || _ONEDPL_MONOTONIC_PRESENT)
-    return __unseq_backend::__simd_copy_if(__first, __last - __first, __result, __pred);
+        return __unseq_backend::__simd_copy_if(__first, __last - __first, __result, __pred);
 #else
-    return ::std::copy_if(__first, __last, __result, __pred);
+        return ::std::copy_if(__first, __last, __result, __pred);
 #endif
 }
 
@@ -1245,6 +1368,27 @@ __brick_calc_mask_1(_RandomAccessIterator __first, _RandomAccessIterator __last,
     return ::std::make_pair(__result, (__last - __first) - __result);
 }
 
+// The assigners of __brick_copy_by_mask; the vector kernels copy the trivially copyable elements for them
+struct __copy_by_mask_assign
+{
+    template <class _Iterator1, class _Iterator2>
+    void
+    operator()(_Iterator1 __x, _Iterator2 __z) const
+    {
+        *__z = *__x;
+    }
+};
+
+struct __copy_by_mask_move_construct
+{
+    template <class _Iterator, class _Tp>
+    void
+    operator()(_Iterator __x, _Tp* __z) const
+    {
+        ::new (std::addressof(*__z)) _Tp(std::move(*__x));
+    }
+};
+
 template <class _ForwardIterator, class _OutputIterator, class _Assigner>
 void
 __brick_copy_by_mask(_ForwardIterator __first, _ForwardIterator __last, _OutputIterator __result, bool* __mask,
@@ -1265,10 +1409,16 @@ void
 __brick_copy_by_mask(_RandomAccessIterator1 __first, _RandomAccessIterator1 __last, _RandomAccessIterator2 __result,
                      bool* __restrict __mask, _Assigner __assigner, /*vector=*/::std::true_type) noexcept
 {
+    if constexpr (__unseq_backend::__simd_kernel_compress_v<_RandomAccessIterator1, _RandomAccessIterator2> &&
+                  (::std::is_same_v<_Assigner, __copy_by_mask_assign> ||
+                   ::std::is_same_v<_Assigner, __copy_by_mask_move_construct>))
+        __unseq_backend::__simd_kernel_compress(__first, __last - __first, __result,
+                                                [__mask](auto __i) -> bool { return __mask[__i]; });
+    else
 #if (_PSTL_MONOTONIC_PRESENT || _ONEDPL_MONOTONIC_PRESENT)
-    __unseq_backend::__simd_copy_by_mask(__first, __last - __first, __result, __mask, __assigner);
+        __unseq_backend::__simd_copy_by_mask(__first, __last - __first, __result, __mask, __assigner);
 #else
-    __internal::__brick_copy_by_mask(__first, __last, __result, __mask, __assigner, ::std::false_type());
+        __internal::__brick_copy_by_mask(__first, __last, __result, __mask, __assigner, ::std::false_type());
 #endif
 }
 
@@ -1298,10 +1448,15 @@ __brick_partition_by_mask(_RandomAccessIterator1 __first, _RandomAccessIterator1
                           _RandomAccessIterator2 __out_true, _RandomAccessIterator3 __out_false, bool* __mask,
                           /*vector=*/::std::true_type) noexcept
 {
+    if constexpr (__unseq_backend::__simd_kernel_compress_v<_RandomAccessIterator1, _RandomAccessIterator2> &&
+                  __unseq_backend::__simd_kernel_compress_v<_RandomAccessIterator1, _RandomAccessIterator3>)
+        __unseq_backend::__simd_kernel_partition(__first, __last - __first, __out_true, __out_false,
+                                                 [__mask](auto __i) -> bool { return __mask[__i]; });
+    else
 #if (_PSTL_MONOTONIC_PRESENT || _ONEDPL_MONOTONIC_PRESENT)
-    __unseq_backend::__simd_partition_by_mask(__first, __last - __first, __out_true, __out_false, __mask);
+        __unseq_backend::__simd_partition_by_mask(__first, __last - __first, __out_true, __out_false, __mask);
 #else
-    __internal::__brick_partition_by_mask(__first, __last, __out_true, __out_false, __mask, ::std::false_type());
+        __internal::__brick_partition_by_mask(__first, __last, __out_true, __out_false, __mask, ::std::false_type());
 #endif
 }
 
@@ -1342,7 +1497,7 @@ __pattern_copy_if(__parallel_tag<_IsVector>, _ExecutionPolicy&& __exec, _RandomA
                 [=](_DifferenceType __i, _DifferenceType __len, _DifferenceType __initial) { // Scan
                     __internal::__brick_copy_by_mask(
                         __first + __i, __first + (__i + __len), __result + __initial, __mask + __i,
-                        [](_RandomAccessIterator1 __x, _RandomAccessIterator2 __z) { *__z = *__x; }, _IsVector{});
+                        __copy_by_mask_assign{}, _IsVector{});
                 },
                 [&__m](_DifferenceType __total) { __m = __total; });
             return __result + __m;
@@ -1360,7 +1515,10 @@ typename ::std::iterator_traits<_RandomAccessIterator>::difference_type
 __brick_count(_RandomAccessIterator __first, _RandomAccessIterator __last, _Predicate __pred,
               /* is_vector = */ ::std::true_type) noexcept
 {
-    return __unseq_backend::__simd_count(__first, __last - __first, __pred);
+    if constexpr (__unseq_backend::__simd_kernel_find_v<_RandomAccessIterator, _Predicate>)
+        return __unseq_backend::__simd_kernel_count(__first, __last - __first, __pred);
+    else
+        return __unseq_backend::__simd_count(__first, __last - __first, __pred);
 }
 
 template <class _ForwardIterator, class _Predicate>
@@ -1498,8 +1656,7 @@ __remove_elements(__parallel_tag<_IsVector>, _ExecutionPolicy&& __exec, _RandomA
             [=](_DifferenceType __i, _DifferenceType __len, _DifferenceType __initial) {
                 __internal::__brick_copy_by_mask(
                     __first + __i, __first + __i + __len, __result + __initial, __mask + __i,
-                    [](_RandomAccessIterator __x, _Tp* __z) { ::new (std::addressof(*__z)) _Tp(std::move(*__x)); },
-                    _IsVector{});
+                    __copy_by_mask_move_construct{}, _IsVector{});
             },
             [&__m](_DifferenceType __total) { __m = __total; });
 
@@ -1555,10 +1712,16 @@ _RandomAccessIterator2
 __brick_unique_copy(_RandomAccessIterator1 __first, _RandomAccessIterator1 __last, _RandomAccessIterator2 __result,
                     _BinaryPredicate __pred, /*vector=*/::std::true_type) noexcept
 {
+    if constexpr (__unseq_backend::__simd_kernel_compress_v<_RandomAccessIterator1, _RandomAccessIterator2>)
+        return __result + __unseq_backend::__simd_kernel_compress(
+                              __first, __last - __first, __result, [__first, &__pred](auto __i) -> bool {
+                                  return __i == 0 || !__pred(__first[__i], __first[__i - 1]);
+                              });
+    else
 #if (_PSTL_MONOTONIC_PRESENT || _ONEDPL_MONOTONIC_PRESENT)
-    return __unseq_backend::__simd_unique_copy(__first, __last - __first, __result, __pred);
+        return __unseq_backend::__simd_unique_copy(__first, __last - __first, __result, __pred);
 #else
-    return ::std::unique_copy(__first, __last, __result, __pred);
+        return ::std::unique_copy(__first, __last, __result, __pred);
 #endif
 }
 
@@ -1634,7 +1797,7 @@ __pattern_unique_copy(__parallel_tag<_IsVector>, _ExecutionPolicy&& __exec, _Ran
                         // Phase 2 is same as for __pattern_copy_if
                         __internal::__brick_copy_by_mask(
                             __first + __i, __first + (__i + __len), __result + __initial, __mask + __i,
-                            [](_RandomAccessIterator1 __x, _RandomAccessIterator2 __z) { *__z = *__x; }, _IsVector{});
+                            __copy_by_mask_assign{}, _IsVector{});
                     },
                     [&__m](_DifferenceType __total) { __m = __total; });
                 return __result + __m;
@@ -2332,10 +2495,19 @@ __brick_partition_copy(_RandomAccessIterator1 __first, _RandomAccessIterator1 __
                        _RandomAccessIterator3 __out_false, _UnaryPredicate __pred,
                        /*is_vector=*/::std::true_type) noexcept
 {
+    if constexpr (__unseq_backend::__simd_kernel_compress_v<_RandomAccessIterator1, _RandomAccessIterator2> &&
+                  __unseq_backend::__simd_kernel_compress_v<_RandomAccessIterator1, _RandomAccessIterator3>)
+    {
+        const auto __counts = __unseq_backend::__simd_kernel_partition(
+            __first, __last - __first, __out_true, __out_false,
+            [__first, &__pred](auto __i) -> bool { return __pred(__first[__i]); });
+        return ::std::make_pair(__out_true + __counts.first, __out_false + __counts.second);
+    }
+    else
 #if (_PSTL_MONOTONIC_PRESENT || _ONEDPL_MONOTONIC_PRESENT)
-    return __unseq_backend::__simd_partition_copy(__first, __last - __first, __out_true, __out_false, __pred);
+        return __unseq_backend::__simd_partition_copy(__first, __last - __first, __out_true, __out_false, __pred);
 #else
-    return ::std::partition_copy(__first, __last, __out_true, __out_false, __pred);
+        return ::std::partition_copy(__first, __last, __out_true, __out_false, __pred);
 #endif
 }
 
@@ -2443,13 +2615,76 @@ __pattern_sort_by_key(_Tag, _ExecutionPolicy&&, _RandomAccessIterator1 __keys_fi
     __leaf_sort(__beg, __end, __cmp_f);
 }
 
+// The contiguous sequences of trivially copyable keys and values, which the parallel sort_by_key sorts as pairs of
+// a key and the index of its value, and then gathers the values in one pass, instead of moving the values along with
+// the keys through zip_iterator at each level of the merges
+template <typename _RandomAccessIterator1, typename _RandomAccessIterator2>
+inline constexpr bool __is_sort_by_key_permutation_v =
+    ::std::is_trivially_copyable_v<typename __unseq_backend::__contiguous_value<_RandomAccessIterator1>::type> &&
+    ::std::is_trivially_copyable_v<typename __unseq_backend::__contiguous_value<_RandomAccessIterator2>::type>;
+
+template <typename _IsVector, typename _ExecutionPolicy, typename _RandomAccessIterator1,
+          typename _RandomAccessIterator2, typename _Compare, typename _LeafSort>
+void
+__parallel_sort_by_key_permutation(__parallel_tag<_IsVector>, _ExecutionPolicy&& __exec,
+                                   _RandomAccessIterator1 __keys_first, _RandomAccessIterator1 __keys_last,
+                                   _RandomAccessIterator2 __values_first, _Compare __comp, _LeafSort __leaf_sort)
+{
+    using __backend_tag = typename __parallel_tag<_IsVector>::__backend_tag;
+    using _KeyType = typename ::std::iterator_traits<_RandomAccessIterator1>::value_type;
+    using _ValueType = typename ::std::iterator_traits<_RandomAccessIterator2>::value_type;
+    using _Pair = ::std::pair<_KeyType, ::std::uint32_t>;
+
+    const ::std::size_t __n = __keys_last - __keys_first;
+    __par_backend::__buffer<_ExecutionPolicy, _Pair> __pairs_buf(__exec, __n);
+    __par_backend::__buffer<_ExecutionPolicy, _ValueType> __values_buf(__exec, __n);
+    _Pair* __pairs = __pairs_buf.get();
+    _ValueType* __values = __values_buf.get();
+
+    __par_backend::__parallel_for(__backend_tag{}, __exec, ::std::size_t(0), __n,
+                                  [__pairs, __keys_first](::std::size_t __i, ::std::size_t __j) {
+                                      for (; __i != __j; ++__i)
+                                          ::new (__pairs + __i) _Pair(__keys_first[__i], ::std::uint32_t(__i));
+                                  });
+    __par_backend::__parallel_stable_sort(
+        __backend_tag{}, __exec, __pairs, __pairs + __n,
+        [__comp](const _Pair& __a, const _Pair& __b) { return __comp(__a.first, __b.first); },
+        [__leaf_sort](auto __first, auto __last, auto __cmp) { __leaf_sort(__first, __last, __cmp); }, __n);
+    __par_backend::__parallel_for(__backend_tag{}, __exec, ::std::size_t(0), __n,
+                                  [__pairs, __values, __values_first](::std::size_t __i, ::std::size_t __j) {
+                                      for (; __i != __j; ++__i)
+                                          ::new (__values + __i) _ValueType(__values_first[__pairs[__i].second]);
+                                  });
+    __par_backend::__parallel_for(
+        __backend_tag{}, ::std::forward<_ExecutionPolicy>(__exec), ::std::size_t(0), __n,
+        [__pairs, __values, __keys_first, __values_first](::std::size_t __i, ::std::size_t __j) {
+            for (; __i != __j; ++__i)
+            {
+                __keys_first[__i] = __pairs[__i].first;
+                __values_first[__i] = __values[__i];
+            }
+        });
+}
+
 template <typename _IsVector, typename _ExecutionPolicy, typename _RandomAccessIterator1,
           typename _RandomAccessIterator2, typename _Compare, typename _LeafSort>
 void
-__pattern_sort_by_key(__parallel_tag<_IsVector>, _ExecutionPolicy&& __exec, _RandomAccessIterator1 __keys_first,
+__pattern_sort_by_key(__parallel_tag<_IsVector> __tag, _ExecutionPolicy&& __exec, _RandomAccessIterator1 __keys_first,
                       _RandomAccessIterator1 __keys_last, _RandomAccessIterator2 __values_first, _Compare __comp,
                       _LeafSort __leaf_sort)
 {
+    if constexpr (__is_sort_by_key_permutation_v<_RandomAccessIterator1, _RandomAccessIterator2>)
+    {
+        if (::std::size_t(__keys_last - __keys_first) <= ::std::numeric_limits<::std::uint32_t>::max())
+        {
+            __internal::__except_handler([&]() {
+                __parallel_sort_by_key_permutation(__tag, ::std::forward<_ExecutionPolicy>(__exec), __keys_first,
+                                                   __keys_last, __values_first, __comp, __leaf_sort);
+            });
+            return;
+        }
+    }
+
     auto __beg = oneapi::dpl::make_zip_iterator(__keys_first, __values_first);
     auto __end = __beg + (__keys_last - __keys_first);
     auto __cmp_f = [__comp](const auto& __a, const auto& __b) { return __comp(std::get<0>(__a), std::get<0>(__b)); };
@@ -2734,6 +2969,11 @@ struct __brick_fill<_Tag, _ExecutionPolicy, _Tp, ::std::enable_if_t<__is_host_di
     operator()(_RandomAccessIterator __first, _RandomAccessIterator __last,
                /* __is_vector = */ ::std::true_type) const noexcept
     {
+        if constexpr (__unseq_backend::__is_bytewise_fill_v<_RandomAccessIterator, _Tp>)
+        {
+            if (__unseq_backend::__simd_fill_bytes(__first, __last - __first, __value))
+                return;
+        }
         __unseq_backend::__simd_fill_n(__first, __last - __first, __value);
     }
 
@@ -2782,6 +3022,11 @@ struct __brick_fill_n<_Tag, _ExecutionPolicy, _Tp, ::std::enable_if_t<__is_host_
     operator()(_RandomAccessIterator __first, _Size __count,
                /* __is_vector = */ ::std::true_type) const noexcept
     {
+        if constexpr (__unseq_backend::__is_bytewise_fill_v<_RandomAccessIterator, _Tp>)
+        {
+            if (__unseq_backend::__simd_fill_bytes(__first, __count, __value))
+                return __first + __count;
+        }
         return __unseq_backend::__simd_fill_n(__first, __count, __value);
     }
 
@@ -2909,10 +3154,16 @@ _RandomAccessIterator
 __brick_remove_if(_RandomAccessIterator __first, _RandomAccessIterator __last, _UnaryPredicate __pred,
                   /* __is_vector = */ ::std::true_type) noexcept
 {
+    // the kept elements are compacted in place
+    if constexpr (__unseq_backend::__simd_kernel_compress_v<_RandomAccessIterator, _RandomAccessIterator>)
+        return __first + __unseq_backend::__simd_kernel_compress(
+                             __first, __last - __first, __first,
+                             [__first, &__pred](auto __i) -> bool { return !__pred(__first[__i]); });
+    else
 #if (_PSTL_MONOTONIC_PRESENT || _ONEDPL_MONOTONIC_PRESENT)
-    return __unseq_backend::__simd_remove_if(__first, __last - __first, __pred);
+        return __unseq_backend::__simd_remove_if(__first, __last - __first, __pred);
 #else
-    return ::std::remove_if(__first, __last, __pred);
+        return ::std::remove_if(__first, __last, __pred);
 #endif
 }
 
@@ -3951,10 +4202,13 @@ _RandomAccessIterator
 __brick_min_element(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp,
                     /* __is_vector = */ ::std::true_type) noexcept
 {
+    if constexpr (__unseq_backend::__simd_kernel_min_element_v<_RandomAccessIterator, _Compare>)
+        return __unseq_backend::__simd_kernel_min_element<_Compare>(__first, __last - __first);
+    else
 #if _ONEDPL_UDR_PRESENT // _PSTL_UDR_PRESENT
-    return __unseq_backend::__simd_min_element(__first, __last - __first, __comp);
+        return __unseq_backend::__simd_min_element(__first, __last - __first, __comp);
 #else
-    return ::std::min_element(__first, __last, __comp);
+        return ::std::min_element(__first, __last, __comp);
 #endif
 }
 
@@ -4103,7 +4357,10 @@ __brick_mismatch(_RandomAccessIterator1 __first1, _RandomAccessIterator1 __last1
                  _RandomAccessIterator2 __last2, _Predicate __pred, /* __is_vector = */ ::std::true_type) noexcept
 {
     auto __n = ::std::min(__last1 - __first1, __last2 - __first2);
-    return __unseq_backend::__simd_first(__first1, __n, __first2, __not_pred<_Predicate&>(__pred));
+    if constexpr (__unseq_backend::__simd_kernel_mismatch_v<_RandomAccessIterator1, _RandomAccessIterator2, _Predicate>)
+        return __unseq_backend::__simd_kernel_mismatch(__first1, __n, __first2);
+    else
+        return __unseq_backend::__simd_first(__first1, __n, __first2, __not_pred<_Predicate&>(__pred));
 }
 
 template <class _Tag, class _ExecutionPolicy, class _ForwardIterator1, class _ForwardIterator2, class _Predicate>
@@ -4156,6 +4413,10 @@ __brick_lexicographical_compare(_RandomAccessIterator1 __first1, _RandomAccessIt
                                 _RandomAccessIterator2 __first2, _RandomAccessIterator2 __last2, _Compare __comp,
                                 /* __is_vector = */ ::std::true_type) noexcept
 {
+    if constexpr (__unseq_backend::__is_bytewise_less_v<_RandomAccessIterator1, _RandomAccessIterator2, _Compare>)
+        return __unseq_backend::__simd_lexicographical_compare_bytes(__first1, __last1 - __first1, __first2,
+                                                                     __last2 - __first2);
+
     if (__first2 == __last2)
     { // if second sequence is empty
         return false;
@@ -4226,13 +4487,20 @@ __pattern_lexicographical_compare(__parallel_tag<_IsVector> __tag, _ExecutionPol
             auto __result = __internal::__parallel_find(
                 __tag, ::std::forward<_ExecutionPolicy>(__exec), __first1, __first1 + __n,
                 [__first1, __first2, &__comp](_RandomAccessIterator1 __i, _RandomAccessIterator1 __j) {
-                    return __internal::__brick_mismatch(
-                               __i, __j, __first2 + (__i - __first1), __first2 + (__j - __first1),
-                               [&__comp](const _RefType1 __x, const _RefType2 __y) {
-                                   return !__comp(__x, __y) && !__comp(__y, __x);
-                               },
-                               _IsVector{})
-                        .first;
+                    // the equivalent bytes are the equal ones, which the vector kernels compare
+                    if constexpr (__unseq_backend::__is_bytewise_less_v<_RandomAccessIterator1,
+                                                                        _RandomAccessIterator2, _Compare>)
+                        return __internal::__brick_mismatch(__i, __j, __first2 + (__i - __first1),
+                                                            __first2 + (__j - __first1), __pstl_equal{}, _IsVector{})
+                            .first;
+                    else
+                        return __internal::__brick_mismatch(
+                                   __i, __j, __first2 + (__i - __first1), __first2 + (__j - __first1),
+                                   [&__comp](const _RefType1 __x, const _RefType2 __y) {
+                                       return !__comp(__x, __y) && !__comp(__y, __x);
+                                   },
+                                   _IsVector{})
+                            .first;
                 },
                 ::std::true_type{});
 
@@ -16,7 +16,10 @@
 #ifndef _ONEDPL_EXPERIMENTAL_FOR_LOOP_H
 #define _ONEDPL_EXPERIMENTAL_FOR_LOOP_H
 
+#include <array>
+#include <cstddef>
 #include <tuple>
+#include <type_traits>
 
 #include "../../onedpl_config.h"
 #include "../../execution_impl.h"
@@ -51,6 +54,78 @@ using type_identity_t = typename type_identity<_Tp>::type;
 //     typedef ::std::true_type __allow_vector;
 // };
 
+// Sizes of a multi-dimensional iteration space [0, __sizes[0]) x ... x [0, __sizes[_Rank - 1]),
+// the last dimension is the innermost one
+template <::std::size_t _Rank, typename _Index = ::std::ptrdiff_t>
+struct extents
+{
+    static_assert(_Rank >= 1, "extents should have at least one dimension");
+
+    ::std::array<_Index, _Rank> __sizes;
+
+    template <typename... _Sizes, typename = ::std::enable_if_t<sizeof...(_Sizes) == _Rank &&
+                                                                (::std::is_convertible_v<_Sizes, _Index> && ...)>>
+    constexpr extents(_Sizes... __s) : __sizes{static_cast<_Index>(__s)...}
+    {
+    }
+
+    static constexpr ::std::size_t
+    rank()
+    {
+        return _Rank;
+    }
+
+    constexpr _Index
+    operator[](::std::size_t __d) const
+    {
+        return __sizes[__d];
+    }
+};
+
+template <typename _Index, typename... _Sizes>
+extents(_Index, _Sizes...) -> extents<1 + sizeof...(_Sizes), _Index>;
+
+// Sizes of the tiles a multi-dimensional iteration space is split into
+template <::std::size_t _Rank, typename _Index = ::std::ptrdiff_t>
+struct tile_sizes
+{
+    ::std::array<_Index, _Rank> __sizes;
+
+    template <typename... _Sizes, typename = ::std::enable_if_t<sizeof...(_Sizes) == _Rank &&
+                                                                (::std::is_convertible_v<_Sizes, _Index> && ...)>>
+    constexpr tile_sizes(_Sizes... __s) : __sizes{static_cast<_Index>(__s)...}
+    {
+    }
+
+    static constexpr ::std::size_t
+    rank()
+    {
+        return _Rank;
+    }
+
+    constexpr _Index
+    operator[](::std::size_t __d) const
+    {
+        return __sizes[__d];
+    }
+};
+
+template <typename _Index, typename... _Sizes>
+tile_sizes(_Index, _Sizes...) -> tile_sizes<1 + sizeof...(_Sizes), _Index>;
+
+template <typename... _Rest>
+struct __is_tiled : ::std::false_type
+{
+};
+
+template <::std::size_t _Rank, typename _Index, typename... _Rest>
+struct __is_tiled<tile_sizes<_Rank, _Index>, _Rest...> : ::std::true_type
+{
+};
+
+template <typename... _Rest>
+inline constexpr bool __is_tiled_v = __is_tiled<::std::decay_t<_Rest>...>::value;
+
 // TODO: add static asserts for parameters according to the requirements
 template <typename _ExecutionPolicy, typename _Ip, typename... _Rest>
 void
@@ -98,6 +173,37 @@ for_loop_n_strided(_ExecutionPolicy&& __exec, _Ip __start, _Size __n, _Sp __stri
                                                  ::std::forward_as_tuple(::std::forward<_Rest>(__rest)...));
 }
 
+// Multi-dimensional versions: f(i0, ..., iN, __rest...) is called for each index of the iteration space,
+// which is processed by tiles; the innermost dimension of a tile is vectorized
+template <typename _ExecutionPolicy, ::std::size_t _Rank, typename _Index, typename _TileIndex, typename... _Rest>
+void
+for_loop(_ExecutionPolicy&& __exec, const extents<_Rank, _Index>& __extents,
+         const tile_sizes<_Rank, _TileIndex>& __tiles, _Rest&&... __rest)
+{
+    static_assert(oneapi::dpl::__internal::__is_host_execution_policy<::std::decay_t<_ExecutionPolicy>>::value,
+                  "for_loop is implemented for the host policies only");
+
+    oneapi::dpl::__internal::__for_loop_repack_tiled(
+        ::std::forward<_ExecutionPolicy>(__exec),
+        oneapi::dpl::__internal::__tiled_space<_Index, _Rank>(__extents.__sizes, __tiles.__sizes),
+        ::std::forward_as_tuple(::std::forward<_Rest>(__rest)...));
+}
+
+template <typename _ExecutionPolicy, ::std::size_t _Rank, typename _Index, typename... _Rest,
+          ::std::enable_if_t<!__is_tiled_v<_Rest...>, int> = 0>
+void
+for_loop(_ExecutionPolicy&& __exec, const extents<_Rank, _Index>& __extents, _Rest&&... __rest)
+{
+    static_assert(oneapi::dpl::__internal::__is_host_execution_policy<::std::decay_t<_ExecutionPolicy>>::value,
+                  "for_loop is implemented for the host policies only");
+
+    oneapi::dpl::__internal::__for_loop_repack_tiled(
+        ::std::forward<_ExecutionPolicy>(__exec),
+        oneapi::dpl::__internal::__tiled_space<_Index, _Rank>(
+            __extents.__sizes, oneapi::dpl::__internal::__default_tile_sizes(__extents.__sizes)),
+        ::std::forward_as_tuple(::std::forward<_Rest>(__rest)...));
+}
+
 // Serial implementations
 template <typename _Ip, typename... _Rest>
 void
@@ -131,6 +237,22 @@ for_loop_n_strided(_Ip __start, _Size __n, _Sp __stride, _Rest&&... __rest)
                                                                   __stride, ::std::forward<_Rest>(__rest)...);
 }
 
+template <::std::size_t _Rank, typename _Index, typename _TileIndex, typename... _Rest>
+void
+for_loop(const extents<_Rank, _Index>& __extents, const tile_sizes<_Rank, _TileIndex>& __tiles, _Rest&&... __rest)
+{
+    oneapi::dpl::experimental::parallelism_v2::for_loop(oneapi::dpl::execution::v1::seq, __extents, __tiles,
+                                                        ::std::forward<_Rest>(__rest)...);
+}
+
+template <::std::size_t _Rank, typename _Index, typename... _Rest, ::std::enable_if_t<!__is_tiled_v<_Rest...>, int> = 0>
+void
+for_loop(const extents<_Rank, _Index>& __extents, _Rest&&... __rest)
+{
+    oneapi::dpl::experimental::parallelism_v2::for_loop(oneapi::dpl::execution::v1::seq, __extents,
+                                                        ::std::forward<_Rest>(__rest)...);
+}
+
 } // namespace parallelism_v2
 } // namespace experimental
 } // namespace dpl
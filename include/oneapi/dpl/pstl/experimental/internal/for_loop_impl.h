@@ -16,6 +16,9 @@
 #ifndef _ONEDPL_EXPERIMENTAL_FOR_LOOP_IMPL_H
 #define _ONEDPL_EXPERIMENTAL_FOR_LOOP_IMPL_H
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <iterator>
 #include <type_traits>
 #include <utility>
@@ -28,6 +31,7 @@
 #include "../../utils.h"
 
 #include "../../parallel_backend.h"
+#include "../../unseq_backend_simd.h"
 
 namespace oneapi
 {
@@ -104,6 +108,37 @@ class __reduction_pack
     // to avoid modification of the original ones.
     ::std::tuple<::std::remove_cv_t<::std::remove_reference_t<_Ts>>...> __objects_;
 
+    template <typename _Tp>
+    using __lane_value_t = typename ::std::remove_cv_t<::std::remove_reference_t<_Tp>>::__lane_value_type;
+
+  public:
+    // Whether a vectorized loop needs SIMD-lane-private copies of the state, i.e. the pack has reductions
+    static constexpr bool __has_lane_state =
+        (false || ... || ::std::remove_cv_t<::std::remove_reference_t<_Ts>>::__has_lane_state);
+
+    // The number of SIMD lanes: as many accumulators of the largest type as fit in a vector register
+    static constexpr ::std::size_t __lane_count =
+        oneapi::dpl::__unseq_backend::__lane_size / ::std::max({::std::size_t(1), sizeof(__lane_value_t<_Ts>)...});
+
+    // The lane-private state, as an array of lanes per object so that the lanes are contiguous in memory
+    using __lanes_type = ::std::tuple<::std::array<__lane_value_t<_Ts>, __lane_count>...>;
+
+  private:
+    template <typename _Tp, ::std::size_t... _Js>
+    static ::std::array<_Tp, __lane_count>
+    __fill_lanes(const _Tp& __value, ::std::index_sequence<_Js...>)
+    {
+        return {{((void)_Js, __value)...}};
+    }
+
+    template <::std::size_t... _Is>
+    __lanes_type
+    __make_lanes_impl(::std::index_sequence<_Is...>) const
+    {
+        return __lanes_type{__fill_lanes(::std::get<_Is>(__objects_).__lane_identity(),
+                                         ::std::make_index_sequence<__lane_count>{})...};
+    }
+
     template <typename _Fp, typename _Ip, typename _Position, ::std::size_t... _Is>
     void
     __apply_func_impl(_Fp&& __f, _Ip __current, _Position __p, ::std::index_sequence<_Is...>)
@@ -111,6 +146,24 @@ class __reduction_pack
         ::std::forward<_Fp>(__f)(__current, ::std::get<_Is>(__objects_).__get_induction_or_reduction_value(__p)...);
     }
 
+    template <typename _Fp, typename _Ip, typename _Position, ::std::size_t... _Is>
+    void
+    __apply_func_lane_impl(_Fp&& __f, _Ip __current, _Position __p, __lanes_type& __lanes, ::std::size_t __lane,
+                           ::std::index_sequence<_Is...>)
+    {
+        ::std::forward<_Fp>(__f)(
+            __current, ::std::get<_Is>(__objects_).__get_lane_value(::std::get<_Is>(__lanes)[__lane], __p)...);
+    }
+
+    template <::std::size_t... _Is>
+    void
+    __combine_lanes_impl(const __lanes_type& __lanes, ::std::index_sequence<_Is...>)
+    {
+        for (::std::size_t __lane = 0; __lane < __lane_count; ++__lane)
+            (void)::std::initializer_list<int>{
+                0, ((void)::std::get<_Is>(__objects_).__combine_lane(::std::get<_Is>(__lanes)[__lane]), 0)...};
+    }
+
     template <::std::size_t... _Is>
     void
     __combine_impl(const __reduction_pack& __other, ::std::index_sequence<_Is...>)
@@ -159,8 +212,82 @@ class __reduction_pack
     {
         __finalize_impl(__n, ::std::make_index_sequence<sizeof...(_Ts)>{});
     }
+
+    // The lane-private state, each lane starting from the identities of the reductions
+    __lanes_type
+    __make_lanes() const
+    {
+        return __make_lanes_impl(::std::make_index_sequence<sizeof...(_Ts)>{});
+    }
+
+    // Same as __apply_func, with the reductions accumulated in the given SIMD lane
+    template <typename _Fp, typename _Ip, typename _Position>
+    void
+    __apply_func_lane(_Fp&& __f, _Ip __current, _Position __p, __lanes_type& __lanes, ::std::size_t __lane)
+    {
+        __apply_func_lane_impl(::std::forward<_Fp>(__f), __current, __p, __lanes, __lane,
+                               ::std::make_index_sequence<sizeof...(_Ts)>{});
+    }
+
+    // Combine the accumulators of all the SIMD lanes into the pack
+    void
+    __combine_lanes(const __lanes_type& __lanes)
+    {
+        __combine_lanes_impl(__lanes, ::std::make_index_sequence<sizeof...(_Ts)>{});
+    }
 };
 
+// Applies __f to the positions __position(__k) with the ordinal positions __offset + __k, for __k in [0, __n).
+template <typename _Size, typename _Pack, typename _Function, typename _PositionFunction>
+void
+__brick_for_loop_n(_Size __n, _Size __offset, _Pack& __pack, _Function __f, _PositionFunction __position,
+                   /*vector=*/::std::false_type) noexcept
+{
+    for (_Size __k = 0; __k < __n; ++__k)
+        __pack.__apply_func(__f, __position(__k), __offset + __k);
+}
+
+// The vectorized version keeps the reductions in SIMD-lane-private accumulators, combined after the loop,
+// so that they are not carried from one iteration to the next; the inductions are computed from the ordinal
+// position in each lane.
+template <typename _Size, typename _Pack, typename _Function, typename _PositionFunction>
+void
+__brick_for_loop_n(_Size __n, _Size __offset, _Pack& __pack, _Function __f, _PositionFunction __position,
+                   /*vector=*/::std::true_type) noexcept
+{
+    if constexpr (!_Pack::__has_lane_state)
+    {
+        _ONEDPL_PRAGMA_SIMD
+        for (_Size __k = 0; __k < __n; ++__k)
+            __pack.__apply_func(__f, __position(__k), __offset + __k);
+    }
+    else if (__n < _Size(2 * _Pack::__lane_count) || _Pack::__lane_count < 2)
+    {
+        oneapi::dpl::__internal::__brick_for_loop_n(__n, __offset, __pack, __f, __position, ::std::false_type{});
+    }
+    else
+    {
+        constexpr _Size __block_size = _Pack::__lane_count;
+        auto __lanes = __pack.__make_lanes();
+
+        const _Size __last_iteration = __block_size * (__n / __block_size);
+        for (_Size __i = 0; __i < __last_iteration; __i += __block_size)
+        {
+            _ONEDPL_PRAGMA_SIMD
+            for (_Size __j = 0; __j < __block_size; ++__j)
+                __pack.__apply_func_lane(__f, __position(__i + __j), __offset + __i + __j, __lanes, __j);
+        }
+        // remainder
+        _ONEDPL_PRAGMA_SIMD
+        for (_Size __j = 0; __j < __n - __last_iteration; ++__j)
+        {
+            __pack.__apply_func_lane(__f, __position(__last_iteration + __j), __offset + __last_iteration + __j,
+                                     __lanes, __j);
+        }
+        __pack.__combine_lanes(__lanes);
+    }
+}
+
 // Sequenced version of for_loop_n
 template <typename _ExecutionPolicy, typename _Ip, typename _Size, typename _Function, typename... _Rest>
 void
@@ -346,9 +473,8 @@ __pattern_for_loop_n(_ExecutionPolicy&&, _Ip __first, _Size __n, _Function __f,
 {
     __reduction_pack<_Rest...> __pack{__reduction_pack_tag(), ::std::forward<_Rest>(__rest)...};
 
-    oneapi::dpl::__internal::__brick_walk1(
-        __n, [&__pack, __first, __f](_Size __idx) { __pack.__apply_func(__f, __first + __idx, __idx); },
-        ::std::true_type{});
+    oneapi::dpl::__internal::__brick_for_loop_n(
+        __n, _Size(0), __pack, __f, [__first](_Size __idx) { return __first + __idx; }, ::std::true_type{});
 
     __pack.__finalize(__n);
 }
@@ -360,9 +486,8 @@ __pattern_for_loop_n(_ExecutionPolicy&&, _Ip __first, _Size __n, _Function __f,
 {
     __reduction_pack<_Rest...> __pack{__reduction_pack_tag(), ::std::forward<_Rest>(__rest)...};
 
-    oneapi::dpl::__internal::__brick_walk1(
-        __n,
-        [&__pack, __first, __f, __stride](_Size __idx) { __pack.__apply_func(__f, __first + __idx * __stride, __idx); },
+    oneapi::dpl::__internal::__brick_for_loop_n(
+        __n, _Size(0), __pack, __f, [__first, __stride](_Size __idx) { return __first + __idx * __stride; },
         ::std::true_type{});
 
     __pack.__finalize(__n);
@@ -403,14 +528,10 @@ __pattern_for_loop_n(_ExecutionPolicy&& __exec, _Ip __first, _Size __n, _Functio
                    __backend_tag{}, ::std::forward<_ExecutionPolicy>(__exec), _Size(0), __n, __identity,
                    [__is_vector, __first, __f](_Size __i, _Size __j, __pack_type __value) {
                        const auto __subseq_start = __first + __i;
-                       const auto __length = __j - __i;
 
-                       oneapi::dpl::__internal::__brick_walk1(
-                           __length,
-                           [&__value, __f, __i, __subseq_start](_Size __idx) {
-                               __value.__apply_func(__f, __subseq_start + __idx, __i + __idx);
-                           },
-                           __is_vector);
+                       oneapi::dpl::__internal::__brick_for_loop_n(
+                           _Size(__j - __i), __i, __value, __f,
+                           [__subseq_start](_Size __idx) { return __subseq_start + __idx; }, __is_vector);
 
                        return __value;
                    },
@@ -439,13 +560,10 @@ __pattern_for_loop_n(_ExecutionPolicy&& __exec, _Ip __first, _Size __n, _Functio
                    __backend_tag{}, ::std::forward<_ExecutionPolicy>(__exec), _Size(0), __n, __identity,
                    [__is_vector, __first, __f, __stride](_Size __i, _Size __j, __pack_type __value) {
                        const auto __subseq_start = __first + __i * __stride;
-                       const auto __length = __j - __i;
 
-                       oneapi::dpl::__internal::__brick_walk1(
-                           __length,
-                           [&__value, __f, __i, __subseq_start, __stride](_Size __idx) {
-                               __value.__apply_func(__f, __subseq_start + __idx * __stride, __i + __idx);
-                           },
+                       oneapi::dpl::__internal::__brick_for_loop_n(
+                           _Size(__j - __i), __i, __value, __f,
+                           [__subseq_start, __stride](_Size __idx) { return __subseq_start + __idx * __stride; },
                            __is_vector);
 
                        return __value;
@@ -471,6 +589,157 @@ __pattern_for_loop(_ExecutionPolicy&& __exec, _Ip __first, _Ip __last, _Function
         __is_vector, ::std::true_type{}, ::std::forward<_Rest>(__rest)...);
 }
 
+// Multi-dimensional version of for_loop: the iteration space is split into tiles, enumerated in the row-major
+// order and distributed by the parallel backend, so that a task works on whole tiles. In a tile, the loops over
+// the outer dimensions are nested and the innermost one is vectorized. The ordinal position of an index, used
+// by the inductions, is its position in the row-major order of the whole space.
+template <typename _Index, ::std::size_t _Rank>
+struct __tiled_space
+{
+    ::std::array<_Index, _Rank> __sizes_;
+    ::std::array<_Index, _Rank> __tile_sizes_;
+    ::std::array<_Index, _Rank> __tile_counts_;
+
+    template <typename _TileIndex>
+    __tiled_space(const ::std::array<_Index, _Rank>& __sizes, const ::std::array<_TileIndex, _Rank>& __tile_sizes)
+        : __sizes_(__sizes)
+    {
+        for (::std::size_t __d = 0; __d < _Rank; ++__d)
+        {
+            assert(__tile_sizes[__d] > 0);
+            __tile_sizes_[__d] = static_cast<_Index>(__tile_sizes[__d]);
+            __tile_counts_[__d] = (__sizes_[__d] + __tile_sizes_[__d] - 1) / __tile_sizes_[__d];
+        }
+    }
+
+    _Index
+    __num_tiles() const
+    {
+        _Index __n = 1;
+        for (::std::size_t __d = 0; __d < _Rank; ++__d)
+            __n *= __tile_counts_[__d];
+        return __n;
+    }
+
+    _Index
+    __size() const
+    {
+        _Index __n = 1;
+        for (::std::size_t __d = 0; __d < _Rank; ++__d)
+            __n *= __sizes_[__d];
+        return __n;
+    }
+
+    // Applies __f to the indices of the tiles in [__tile_first, __tile_last)
+    template <typename _Pack, typename _Function, typename _IsVector>
+    void
+    __apply_tiles(_Index __tile_first, _Index __tile_last, _Pack& __pack, _Function __f, _IsVector __is_vector) const
+    {
+        ::std::array<_Index, _Rank> __first;
+        ::std::array<_Index, _Rank> __last;
+        ::std::array<_Index, _Rank> __index;
+        for (_Index __tile = __tile_first; __tile < __tile_last; ++__tile)
+        {
+            _Index __rest = __tile;
+            for (::std::size_t __d = _Rank; __d-- > 0;)
+            {
+                __first[__d] = (__rest % __tile_counts_[__d]) * __tile_sizes_[__d];
+                __last[__d] = ::std::min<_Index>(__first[__d] + __tile_sizes_[__d], __sizes_[__d]);
+                __rest /= __tile_counts_[__d];
+            }
+            __apply_tile<0>(__first, __last, __index, _Index(0), __pack, __f, __is_vector);
+        }
+    }
+
+  private:
+    template <::std::size_t _Dim, typename _Pack, typename _Function, typename _IsVector>
+    void
+    __apply_tile(const ::std::array<_Index, _Rank>& __first, const ::std::array<_Index, _Rank>& __last,
+                 ::std::array<_Index, _Rank>& __index, _Index __outer_position, _Pack& __pack, _Function __f,
+                 _IsVector __is_vector) const
+    {
+        if constexpr (_Dim + 1 < _Rank)
+        {
+            for (__index[_Dim] = __first[_Dim]; __index[_Dim] < __last[_Dim]; ++__index[_Dim])
+                __apply_tile<_Dim + 1>(__first, __last, __index, __outer_position * __sizes_[_Dim] + __index[_Dim],
+                                       __pack, __f, __is_vector);
+        }
+        else
+        {
+            // the innermost dimension, with the outer indices bound
+            const ::std::array<_Index, _Rank> __outer = __index;
+            auto __g = [__f, __outer](_Index __inner, auto&&... __values) {
+                __outer_apply(__f, __outer, __inner, ::std::make_index_sequence<_Rank - 1>{},
+                              ::std::forward<decltype(__values)>(__values)...);
+            };
+            oneapi::dpl::__internal::__brick_for_loop_n(
+                _Index(__last[_Dim] - __first[_Dim]), __outer_position * __sizes_[_Dim] + __first[_Dim], __pack, __g,
+                [__inner_first = __first[_Dim]](_Index __k) { return __inner_first + __k; }, __is_vector);
+        }
+    }
+
+    template <typename _Function, ::std::size_t... _Ds, typename... _Values>
+    static void
+    __outer_apply(_Function& __f, const ::std::array<_Index, _Rank>& __outer, _Index __inner,
+                  ::std::index_sequence<_Ds...>, _Values&&... __values)
+    {
+        __f(__outer[_Ds]..., __inner, ::std::forward<_Values>(__values)...);
+    }
+};
+
+// The outer dimensions are split into tiles of 16, the innermost one into runs of up to 512 indices
+template <typename _Index, ::std::size_t _Rank>
+::std::array<_Index, _Rank>
+__default_tile_sizes(const ::std::array<_Index, _Rank>& __sizes)
+{
+    ::std::array<_Index, _Rank> __tiles;
+    for (::std::size_t __d = 0; __d + 1 < _Rank; ++__d)
+        __tiles[__d] = 16;
+    __tiles[_Rank - 1] = ::std::max<_Index>(1, ::std::min<_Index>(__sizes[_Rank - 1], 512));
+    return __tiles;
+}
+
+template <typename _ExecutionPolicy, typename _Index, ::std::size_t _Rank, typename _Function, typename _IsVector,
+          typename... _Rest>
+void
+__pattern_for_loop_tiled(_ExecutionPolicy&&, const __tiled_space<_Index, _Rank>& __space, _Function __f,
+                         _IsVector __is_vector, /*parallel=*/::std::false_type, _Rest&&... __rest) noexcept
+{
+    __reduction_pack<_Rest...> __pack{__reduction_pack_tag(), ::std::forward<_Rest>(__rest)...};
+
+    __space.__apply_tiles(_Index(0), __space.__num_tiles(), __pack, __f, __is_vector);
+
+    __pack.__finalize(__space.__size());
+}
+
+template <typename _ExecutionPolicy, typename _Index, ::std::size_t _Rank, typename _Function, typename _IsVector,
+          typename... _Rest>
+void
+__pattern_for_loop_tiled(_ExecutionPolicy&& __exec, const __tiled_space<_Index, _Rank>& __space, _Function __f,
+                         _IsVector __is_vector, /*parallel=*/::std::true_type, _Rest&&... __rest)
+{
+    using __pack_type = __reduction_pack<_Rest...>;
+
+    // Create an identity pack object, operations are done on copies of it.
+    const __pack_type __identity{__reduction_pack_tag(), ::std::forward<_Rest>(__rest)...};
+
+    using __backend_tag = typename oneapi::dpl::__internal::__parallel_tag<_IsVector>::__backend_tag;
+    oneapi::dpl::__internal::__except_handler([&]() {
+        return __par_backend::__parallel_reduce(
+                   __backend_tag{}, ::std::forward<_ExecutionPolicy>(__exec), _Index(0), __space.__num_tiles(),
+                   __identity,
+                   [&__space, __f, __is_vector](_Index __i, _Index __j, __pack_type __value) {
+                       __space.__apply_tiles(__i, __j, __value, __f, __is_vector);
+                       return __value;
+                   },
+                   [](__pack_type __lhs, const __pack_type& __rhs) {
+                       __lhs.__combine(__rhs);
+                       return __lhs;
+                   })
+            .__finalize(__space.__size());
+    });
+}
+
 // Helper structure to split code functions for integral and iterator types so the return
 // value can be successfully deduced.
 template <typename _Ip>
@@ -536,6 +805,30 @@ __for_loop_n_impl(_ExecutionPolicy&& __exec, _Ip __start, _Size __n, _Fp&& __f,
         ::std::get<_Is>(::std::move(__t))...);
 }
 
+template <typename _ExecutionPolicy, typename _Index, ::std::size_t _Rank, typename _Fp, typename... _Rest,
+          ::std::size_t... _Is>
+void
+__for_loop_tiled_impl(_ExecutionPolicy&& __exec, const __tiled_space<_Index, _Rank>& __space, _Fp&& __f,
+                      ::std::tuple<_Rest...>&& __t, ::std::index_sequence<_Is...>)
+{
+    oneapi::dpl::__internal::__pattern_for_loop_tiled(
+        ::std::forward<_ExecutionPolicy>(__exec), __space, __f,
+        oneapi::dpl::__internal::__use_vectorization<_ExecutionPolicy, _Index>(__exec),
+        oneapi::dpl::__internal::__use_parallelization<_ExecutionPolicy, _Index>(__exec),
+        ::std::get<_Is>(::std::move(__t))...);
+}
+
+template <typename _ExecutionPolicy, typename _Index, ::std::size_t _Rank, typename... _Rest>
+void
+__for_loop_repack_tiled(_ExecutionPolicy&& __exec, const __tiled_space<_Index, _Rank>& __space,
+                        ::std::tuple<_Rest...>&& __t)
+{
+    // Extract a callable object from the parameter pack and put it before the other elements
+    oneapi::dpl::__internal::__for_loop_tiled_impl(::std::forward<_ExecutionPolicy>(__exec), __space,
+                                                   ::std::get<sizeof...(_Rest) - 1>(__t), ::std::move(__t),
+                                                   ::std::make_index_sequence<sizeof...(_Rest) - 1>());
+}
+
 template <typename _ExecutionPolicy, typename _Ip, typename _Sp, typename... _Rest>
 void
 __for_loop_repack(_ExecutionPolicy&& __exec, _Ip __start, _Ip __finish, _Sp __stride, ::std::tuple<_Rest...>&& __t)
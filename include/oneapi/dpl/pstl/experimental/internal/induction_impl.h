@@ -38,6 +38,11 @@ using __induction_value_type =
 
 // Definition of induction_object structure to represent "induction" object.
 
+// Inductions are computed from the ordinal position, so they keep no state private to a SIMD lane.
+struct __induction_lane_value
+{
+};
+
 template <typename _Tp, typename _Sp>
 class __induction_object
 {
@@ -47,6 +52,9 @@ class __induction_object
     const _Sp __stride_;
 
   public:
+    using __lane_value_type = __induction_lane_value;
+    static constexpr bool __has_lane_state = false;
+
     __induction_object(__value_type __var, _Sp __stride) : __var_(__var), __stride_(__stride) {}
 
     __induction_object&
@@ -64,6 +72,24 @@ class __induction_object
         return __var_ + __p * __stride_;
     }
 
+    __lane_value_type
+    __lane_identity() const
+    {
+        return {};
+    }
+
+    template <typename _Index>
+    ::std::remove_reference_t<__value_type>
+    __get_lane_value(__lane_value_type&, _Index __p)
+    {
+        return __var_ + __p * __stride_;
+    }
+
+    void
+    __combine_lane(const __lane_value_type&)
+    {
+    }
+
     void
     __combine(const __induction_object&)
     {
@@ -86,6 +112,9 @@ class __induction_object<_Tp, void>
     __value_type __var_;
 
   public:
+    using __lane_value_type = __induction_lane_value;
+    static constexpr bool __has_lane_state = false;
+
     __induction_object(__value_type __var) : __var_(__var) {}
 
     __induction_object&
@@ -102,6 +131,24 @@ class __induction_object<_Tp, void>
         return __var_ + __p;
     }
 
+    __lane_value_type
+    __lane_identity() const
+    {
+        return {};
+    }
+
+    template <typename _Index>
+    ::std::remove_reference_t<__value_type>
+    __get_lane_value(__lane_value_type&, _Index __p)
+    {
+        return __var_ + __p;
+    }
+
+    void
+    __combine_lane(const __lane_value_type&)
+    {
+    }
+
     void
     __combine(const __induction_object&)
     {
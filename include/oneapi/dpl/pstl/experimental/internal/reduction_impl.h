@@ -41,11 +41,17 @@ class __reduction_object
     _Tp& __value_;
     // Current accumulated value.
     _Tp __acc_;
+    // The initial value of the accumulators of the SIMD lanes.
+    _Tp __identity_;
     _Combiner __combiner_;
 
   public:
+    // The state private to a SIMD lane of a vectorized loop: a separate accumulator.
+    using __lane_value_type = _Tp;
+    static constexpr bool __has_lane_state = true;
+
     __reduction_object(_Tp& __value, _Tp __identity, _Combiner __combiner)
-        : __value_(__value), __acc_(__identity), __combiner_(__combiner)
+        : __value_(__value), __acc_(__identity), __identity_(__identity), __combiner_(__combiner)
     {
     }
 
@@ -57,6 +63,7 @@ class __reduction_object
         // No need to move, passed by reference
         __value_ = __other.__value_;
         __acc_ = ::std::move(__other.__acc_);
+        __identity_ = ::std::move(__other.__identity_);
         __combiner_ = ::std::move(__other.__combiner_);
         return *this;
     }
@@ -70,6 +77,27 @@ class __reduction_object
         return __acc_;
     }
 
+    __lane_value_type
+    __lane_identity() const
+    {
+        return __identity_;
+    }
+
+    // The accumulator of a SIMD lane, used in place of the shared one.
+    template <typename _Index>
+    _Tp&
+    __get_lane_value(__lane_value_type& __lane, _Index)
+    {
+        return __lane;
+    }
+
+    // Combine the accumulator of a SIMD lane into the current accumulated value.
+    void
+    __combine_lane(const __lane_value_type& __lane)
+    {
+        __acc_ = __combiner_(__acc_, __lane);
+    }
+
     // Combine 2 reduction objects together.
     void
     __combine(const __reduction_object& __other)
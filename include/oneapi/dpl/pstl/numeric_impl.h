@@ -44,7 +44,16 @@ __brick_transform_reduce(_ForwardIterator1 __first1, _ForwardIterator1 __last1,
                          _BinaryOperation1 __binary_op1, _BinaryOperation2 __binary_op2,
                          /*is_vector=*/::std::false_type) noexcept
 {
-    return ::std::inner_product(__first1, __last1, __first2, __init, __binary_op1, __binary_op2);
+    if constexpr (__unseq_backend::__use_prefetched_walk_v<_ForwardIterator1, _ForwardIterator2>)
+    {
+        auto __f = [&__init, &__binary_op1, &__binary_op2](auto&& __x, auto&& __y) {
+            __init = __binary_op1(::std::move(__init), __binary_op2(__x, __y));
+        };
+        __unseq_backend::__prefetched_walk(__last1 - __first1, __f, __first1, __first2);
+        return __init;
+    }
+    else
+        return ::std::inner_product(__first1, __last1, __first2, __init, __binary_op1, __binary_op2);
 }
 
 template <class _RandomAccessIterator1, class _RandomAccessIterator2, class _Tp, class _BinaryOperation1,
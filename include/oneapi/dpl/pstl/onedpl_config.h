@@ -226,9 +226,46 @@
 #    define _ONEDPL_PRAGMA_VECTOR_UNALIGNED
 #endif
 
+// Explicit x86 vector kernels of the unsequenced algorithms for the arithmetic types, chosen by the target
+// instruction set at compile time; ONEDPL_DISABLE_SIMD_KERNELS falls back to the pragma based loops
+#if !defined(ONEDPL_DISABLE_SIMD_KERNELS) && defined(__AVX512F__) && defined(__AVX512BW__)
+#    define _ONEDPL_SIMD_X86_AVX512 1
+#else
+#    define _ONEDPL_SIMD_X86_AVX512 0
+#endif
+#if _ONEDPL_SIMD_X86_AVX512 && defined(__AVX512VBMI2__)
+#    define _ONEDPL_SIMD_X86_AVX512_VBMI2 1
+#else
+#    define _ONEDPL_SIMD_X86_AVX512_VBMI2 0
+#endif
+#if !defined(ONEDPL_DISABLE_SIMD_KERNELS) && defined(__AVX2__)
+#    define _ONEDPL_SIMD_X86_AVX2 1
+#else
+#    define _ONEDPL_SIMD_X86_AVX2 0
+#endif
+
+// The number of the elements ahead of the current one which the serial loops over permutation_iterator prefetch;
+// zero disables the prefetching
+#if !defined(ONEDPL_PREFETCH_DISTANCE)
+#    define ONEDPL_PREFETCH_DISTANCE 32
+#endif
+#if _ONEDPL_GCC_VERSION > 0 || defined(_ONEDPL_CLANG_VERSION)
+#    define _ONEDPL_PREFETCH(__p) __builtin_prefetch(__p)
+#    define _ONEDPL_PREFETCH_PRESENT (ONEDPL_PREFETCH_DISTANCE > 0)
+#else
+#    define _ONEDPL_PREFETCH(__p)
+#    define _ONEDPL_PREFETCH_PRESENT 0
+#endif
+
 // Check the user-defined macro to use non-temporal stores
+#if defined(PSTL_USE_NONTEMPORAL_STORES) && (__INTEL_LLVM_COMPILER || __INTEL_COMPILER >= 1600)
+#    define _ONEDPL_NONTEMPORAL_STORES_PRESENT 1
+#else
+#    define _ONEDPL_NONTEMPORAL_STORES_PRESENT 0
+#endif
+
 #ifndef _PSTL_USE_NONTEMPORAL_STORES_IF_ALLOWED
-#    if defined(PSTL_USE_NONTEMPORAL_STORES) && (__INTEL_LLVM_COMPILER || __INTEL_COMPILER >= 1600)
+#    if _ONEDPL_NONTEMPORAL_STORES_PRESENT
 #        define _PSTL_USE_NONTEMPORAL_STORES_IF_ALLOWED _PSTL_PRAGMA(vector nontemporal)
 #    else
 #        define _PSTL_USE_NONTEMPORAL_STORES_IF_ALLOWED
@@ -238,6 +238,446 @@ namespace views
 NANO_INLINE_VAR(nano::detail::rotate_view_fn, rotate)
 }
 
+// The iterator over every stride-th element of a sequence; the element with the index i is the element of the base
+// sequence with the index i * stride, so that the vectorized loops over it gather the elements
+template <typename I>
+class stride_iterator
+{
+  public:
+    using iterator_type = I;
+    using difference_type = iter_difference_t<I>;
+    using value_type = iter_value_t<I>;
+    using iterator_category = detail::legacy_iterator_category_t<I>;
+    using reference = iter_reference_t<I>;
+    using pointer = I;
+
+    stride_iterator() = default;
+    stride_iterator(const stride_iterator&) = default;
+    constexpr stride_iterator&
+    operator=(const stride_iterator&) = default;
+
+    explicit stride_iterator(I b, difference_type pos, difference_type stride) : beg_(b), pos_(pos), stride_(stride)
+    {
+        assert(stride > 0);
+    }
+
+    constexpr reference operator*() const { return beg_[pos_ * stride_]; }
+    constexpr reference operator[](difference_type __i) const { return beg_[(pos_ + __i) * stride_]; }
+    constexpr difference_type
+    operator-(const stride_iterator& __it) const
+    {
+        return pos_ - __it.pos_;
+    }
+    constexpr stride_iterator&
+    operator+=(difference_type __forward)
+    {
+        pos_ += __forward;
+        return *this;
+    }
+    constexpr stride_iterator&
+    operator-=(difference_type __backward)
+    {
+        return *this += -__backward;
+    }
+    constexpr stride_iterator&
+    operator++()
+    {
+        return *this += 1;
+    }
+    constexpr stride_iterator&
+    operator--()
+    {
+        return *this -= 1;
+    }
+    constexpr stride_iterator
+    operator++(int)
+    {
+        stride_iterator __it(*this);
+        ++(*this);
+        return __it;
+    }
+    constexpr stride_iterator
+    operator--(int)
+    {
+        stride_iterator __it(*this);
+        --(*this);
+        return __it;
+    }
+
+    constexpr stride_iterator
+    operator-(difference_type __backward) const
+    {
+        stride_iterator it(*this);
+        return it -= __backward;
+    }
+    constexpr stride_iterator
+    operator+(difference_type __forward) const
+    {
+        stride_iterator it(*this);
+        return it += __forward;
+    }
+    friend constexpr stride_iterator
+    operator+(difference_type __forward, const stride_iterator __it)
+    {
+        return __it + __forward;
+    }
+    constexpr bool
+    operator==(const stride_iterator& __it) const
+    {
+        return *this - __it == 0;
+    }
+    constexpr bool
+    operator!=(const stride_iterator& __it) const
+    {
+        return !(*this == __it);
+    }
+    constexpr bool
+    operator<(const stride_iterator& __it) const
+    {
+        return *this - __it < 0;
+    }
+    constexpr bool
+    operator>(const stride_iterator& __it) const
+    {
+        return __it < *this;
+    }
+    constexpr bool
+    operator<=(const stride_iterator& __it) const
+    {
+        return !(*this > __it);
+    }
+    constexpr bool
+    operator>=(const stride_iterator& __it) const
+    {
+        return !(*this < __it);
+    }
+
+  private:
+    I beg_{};
+    difference_type pos_ = 0;
+    difference_type stride_ = 1;
+};
+
+namespace stride_view_
+{
+
+template <typename V>
+struct stride_view : view_interface<stride_view<V>>
+{
+  private:
+    static_assert(range<V>);
+    static_assert(random_access_iterator<iterator_t<V>>);
+    static_assert(view<V>);
+
+    V base_ = V();
+    range_difference_t<V> stride_ = 1;
+
+  public:
+    stride_view() = default;
+
+    constexpr stride_view(V base, range_difference_t<V> stride) : base_(::std::move(base)), stride_(stride) {}
+
+    template <typename R, ::std::enable_if_t<random_access_range<R> && viewable_range<R> &&
+                                                 constructible_from<V, all_view<R>>,
+                                             int> = 0>
+    constexpr stride_view(R&& r, range_difference_t<V> stride)
+        : base_(views::all(::std::forward<R>(r))), stride_(stride)
+    {
+    }
+
+    constexpr V
+    base() const
+    {
+        return base_;
+    }
+
+    constexpr range_difference_t<V>
+    stride() const
+    {
+        return stride_;
+    }
+
+    constexpr auto
+    begin() const
+    {
+        return stride_iterator(base().begin(), 0, stride_);
+    }
+
+    constexpr auto
+    end() const
+    {
+        return begin() + size();
+    }
+
+    // the last element may be followed by less than stride - 1 elements of the base sequence
+    constexpr auto
+    size() const
+    {
+        return (base_.size() + stride_ - 1) / stride_;
+    }
+
+    constexpr bool
+    empty() const
+    {
+        return size() == 0;
+    }
+};
+
+template <typename R>
+stride_view(R &&)->stride_view<all_view<R>>;
+
+} // namespace stride_view_
+
+using stride_view_::stride_view;
+
+// The iterator over the consecutive subranges of chunk elements of a sequence; the last of them may be shorter
+template <typename I>
+class chunk_iterator
+{
+  public:
+    using iterator_type = I;
+    using difference_type = iter_difference_t<I>;
+    using value_type = subrange<I>;
+    using iterator_category = ::std::random_access_iterator_tag;
+    using reference = subrange<I>;
+    using pointer = void;
+
+    chunk_iterator() = default;
+    chunk_iterator(const chunk_iterator&) = default;
+    constexpr chunk_iterator&
+    operator=(const chunk_iterator&) = default;
+
+    explicit chunk_iterator(I b, difference_type pos, difference_type chunk, difference_type n)
+        : beg_(b), pos_(pos), chunk_(chunk), n_(n)
+    {
+        assert(chunk > 0);
+    }
+
+    constexpr reference operator*() const { return (*this)[0]; }
+    constexpr reference operator[](difference_type __i) const
+    {
+        const difference_type __first = (pos_ + __i) * chunk_;
+        const difference_type __last = __first + chunk_ < n_ ? __first + chunk_ : n_;
+        return subrange<I>(beg_ + __first, beg_ + __last);
+    }
+    constexpr difference_type
+    operator-(const chunk_iterator& __it) const
+    {
+        return pos_ - __it.pos_;
+    }
+    constexpr chunk_iterator&
+    operator+=(difference_type __forward)
+    {
+        pos_ += __forward;
+        return *this;
+    }
+    constexpr chunk_iterator&
+    operator-=(difference_type __backward)
+    {
+        return *this += -__backward;
+    }
+    constexpr chunk_iterator&
+    operator++()
+    {
+        return *this += 1;
+    }
+    constexpr chunk_iterator&
+    operator--()
+    {
+        return *this -= 1;
+    }
+    constexpr chunk_iterator
+    operator++(int)
+    {
+        chunk_iterator __it(*this);
+        ++(*this);
+        return __it;
+    }
+    constexpr chunk_iterator
+    operator--(int)
+    {
+        chunk_iterator __it(*this);
+        --(*this);
+        return __it;
+    }
+
+    constexpr chunk_iterator
+    operator-(difference_type __backward) const
+    {
+        chunk_iterator it(*this);
+        return it -= __backward;
+    }
+    constexpr chunk_iterator
+    operator+(difference_type __forward) const
+    {
+        chunk_iterator it(*this);
+        return it += __forward;
+    }
+    friend constexpr chunk_iterator
+    operator+(difference_type __forward, const chunk_iterator __it)
+    {
+        return __it + __forward;
+    }
+    constexpr bool
+    operator==(const chunk_iterator& __it) const
+    {
+        return *this - __it == 0;
+    }
+    constexpr bool
+    operator!=(const chunk_iterator& __it) const
+    {
+        return !(*this == __it);
+    }
+    constexpr bool
+    operator<(const chunk_iterator& __it) const
+    {
+        return *this - __it < 0;
+    }
+    constexpr bool
+    operator>(const chunk_iterator& __it) const
+    {
+        return __it < *this;
+    }
+    constexpr bool
+    operator<=(const chunk_iterator& __it) const
+    {
+        return !(*this > __it);
+    }
+    constexpr bool
+    operator>=(const chunk_iterator& __it) const
+    {
+        return !(*this < __it);
+    }
+
+  private:
+    I beg_{};
+    difference_type pos_ = 0;
+    difference_type chunk_ = 1;
+    difference_type n_ = 0;
+};
+
+namespace chunk_view_
+{
+
+template <typename V>
+struct chunk_view : view_interface<chunk_view<V>>
+{
+  private:
+    static_assert(range<V>);
+    static_assert(random_access_iterator<iterator_t<V>>);
+    static_assert(view<V>);
+
+    V base_ = V();
+    range_difference_t<V> chunk_ = 1;
+
+  public:
+    chunk_view() = default;
+
+    constexpr chunk_view(V base, range_difference_t<V> chunk) : base_(::std::move(base)), chunk_(chunk) {}
+
+    template <typename R, ::std::enable_if_t<random_access_range<R> && viewable_range<R> &&
+                                                 constructible_from<V, all_view<R>>,
+                                             int> = 0>
+    constexpr chunk_view(R&& r, range_difference_t<V> chunk)
+        : base_(views::all(::std::forward<R>(r))), chunk_(chunk)
+    {
+    }
+
+    constexpr V
+    base() const
+    {
+        return base_;
+    }
+
+    constexpr auto
+    begin() const
+    {
+        return chunk_iterator(base().begin(), 0, chunk_, range_difference_t<V>(base_.size()));
+    }
+
+    constexpr auto
+    end() const
+    {
+        return begin() + size();
+    }
+
+    constexpr auto
+    size() const
+    {
+        return (base_.size() + chunk_ - 1) / chunk_;
+    }
+
+    constexpr bool
+    empty() const
+    {
+        return size() == 0;
+    }
+};
+
+template <typename R>
+chunk_view(R &&)->chunk_view<all_view<R>>;
+
+} // namespace chunk_view_
+
+using chunk_view_::chunk_view;
+
+namespace detail
+{
+
+struct stride_view_fn
+{
+    template <typename E>
+    constexpr auto
+    operator()(E&& e, range_difference_t<E> stride) const -> decltype(stride_view{::std::forward<E>(e), stride})
+    {
+        return stride_view{::std::forward<E>(e), stride};
+    }
+
+    template <typename D>
+    constexpr auto
+    operator()(D stride) const
+    {
+        return detail::rao_proxy{[stride](auto&& r) mutable
+#ifndef NANO_MSVC_LAMBDA_PIPE_WORKAROUND
+                                 -> decltype(stride_view{::std::forward<decltype(r)>(r), stride})
+#endif
+                                 {
+                                     return stride_view{::std::forward<decltype(r)>(r), stride};
+                                 }};
+    }
+};
+
+struct chunk_view_fn
+{
+    template <typename E>
+    constexpr auto
+    operator()(E&& e, range_difference_t<E> chunk) const -> decltype(chunk_view{::std::forward<E>(e), chunk})
+    {
+        return chunk_view{::std::forward<E>(e), chunk};
+    }
+
+    template <typename D>
+    constexpr auto
+    operator()(D chunk) const
+    {
+        return detail::rao_proxy{[chunk](auto&& r) mutable
+#ifndef NANO_MSVC_LAMBDA_PIPE_WORKAROUND
+                                 -> decltype(chunk_view{::std::forward<decltype(r)>(r), chunk})
+#endif
+                                 {
+                                     return chunk_view{::std::forward<decltype(r)>(r), chunk};
+                                 }};
+    }
+};
+
+} // namespace detail
+
+namespace views
+{
+NANO_INLINE_VAR(nano::detail::stride_view_fn, stride)
+NANO_INLINE_VAR(nano::detail::chunk_view_fn, chunk)
+} // namespace views
+
 namespace detail
 {
 
@@ -46,9 +46,11 @@ using oneapi::dpl::__ranges::guard_view;
 using oneapi::dpl::__ranges::zip_view;
 
 //views
+using __nanorange::nano::ranges::chunk_view;
 using __nanorange::nano::ranges::drop_view;
 using __nanorange::nano::ranges::iota_view;
 using __nanorange::nano::ranges::reverse_view;
+using __nanorange::nano::ranges::stride_view;
 using __nanorange::nano::ranges::take_view;
 using __nanorange::nano::ranges::transform_view;
 
@@ -62,12 +64,14 @@ using oneapi::dpl::__ranges::views::all_write;
 using oneapi::dpl::__ranges::views::host_all;
 #endif // _ONEDPL_BACKEND_SYCL
 
+using __nanorange::nano::views::chunk;
 using __nanorange::nano::views::drop;
 using __nanorange::nano::views::fill;
 using __nanorange::nano::views::generate;
 using __nanorange::nano::views::iota;
 using __nanorange::nano::views::reverse;
 using __nanorange::nano::views::rotate;
+using __nanorange::nano::views::stride;
 using __nanorange::nano::views::take;
 using __nanorange::nano::views::transform;
 
@@ -0,0 +1,127 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _ONEDPL_SEARCHER_UTILS_H
+#define _ONEDPL_SEARCHER_UTILS_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+
+#include "utils.h"
+
+namespace oneapi
+{
+namespace dpl
+{
+namespace __internal
+{
+
+// The length of the subsequence from which search and find_end use __horspool_searcher
+inline constexpr ::std::size_t __horspool_min_size = 8;
+
+template <typename _Tp>
+inline constexpr bool __is_horspool_value_v =
+    (::std::is_integral_v<_Tp> && !::std::is_same_v<_Tp, bool>) || ::std::is_same_v<_Tp, ::std::byte>;
+
+// Whether search and find_end with _Pred may use __horspool_searcher: random access sequences of the same
+// integer (or std::byte) type compared with "=="
+template <typename _Iterator1, typename _Iterator2, typename _Pred>
+inline constexpr bool __use_horspool_v =
+    __is_random_access_iterator_v<_Iterator1, _Iterator2> &&
+    ::std::is_same_v<typename ::std::iterator_traits<_Iterator1>::value_type,
+                     typename ::std::iterator_traits<_Iterator2>::value_type> &&
+    __is_horspool_value_v<typename ::std::iterator_traits<_Iterator2>::value_type> &&
+    __is_equality_pred<_Pred, typename ::std::iterator_traits<_Iterator2>::value_type>::value;
+
+// Boyer-Moore-Horspool search of the subsequence [__s_first, __s_first + __m). The values are hashed into
+// 256 buckets, which is exact for the bytes; a shift of a bucket is the smallest of the shifts of its values,
+// so collisions only shorten the shifts. A forward searcher aligns the shifts on the last value of the
+// subsequence and finds the first occurrence; a backward one aligns them on the first value and finds the last.
+template <typename _RandomAccessIterator2>
+class __horspool_searcher
+{
+    using _Tp = typename ::std::iterator_traits<_RandomAccessIterator2>::value_type;
+    using _DifferenceType = typename ::std::iterator_traits<_RandomAccessIterator2>::difference_type;
+
+    _RandomAccessIterator2 __s_first_;
+    _DifferenceType __m_;
+    _DifferenceType __shift_[256];
+
+    static ::std::size_t
+    __bucket(const _Tp& __x)
+    {
+        if constexpr (sizeof(_Tp) == 1)
+            return static_cast<unsigned char>(__x);
+        else
+            return ::std::size_t((::std::uint64_t(__x) * 0x9E3779B97F4A7C15ull) >> 56);
+    }
+
+  public:
+    __horspool_searcher(_RandomAccessIterator2 __s_first, _RandomAccessIterator2 __s_last, bool __forward)
+        : __s_first_(__s_first), __m_(__s_last - __s_first)
+    {
+        ::std::fill(__shift_, __shift_ + 256, __m_);
+        if (__forward)
+        {
+            for (_DifferenceType __i = 0; __i < __m_ - 1; ++__i)
+                __shift_[__bucket(__s_first[__i])] = __m_ - 1 - __i;
+        }
+        else
+        {
+            for (_DifferenceType __i = __m_ - 1; __i > 0; --__i)
+                __shift_[__bucket(__s_first[__i])] = __i;
+        }
+    }
+
+    // The first occurrence starting in [__first, __last) and ending before __global_last, or __last
+    template <typename _RandomAccessIterator1>
+    _RandomAccessIterator1
+    __find_first(_RandomAccessIterator1 __first, _RandomAccessIterator1 __last,
+                 _RandomAccessIterator1 __global_last) const
+    {
+        const _DifferenceType __n = ::std::min<_DifferenceType>(__last - __first, __global_last - __first - __m_ + 1);
+        const _Tp __s_back = __s_first_[__m_ - 1];
+        for (_DifferenceType __i = 0; __i < __n;)
+        {
+            const _Tp __back = __first[__i + __m_ - 1];
+            if (__back == __s_back && ::std::equal(__s_first_, __s_first_ + (__m_ - 1), __first + __i))
+                return __first + __i;
+            __i += __shift_[__bucket(__back)];
+        }
+        return __last;
+    }
+
+    // The last occurrence starting in [__first, __last) and ending before __global_last, or __last
+    template <typename _RandomAccessIterator1>
+    _RandomAccessIterator1
+    __find_last(_RandomAccessIterator1 __first, _RandomAccessIterator1 __last,
+                _RandomAccessIterator1 __global_last) const
+    {
+        const _DifferenceType __n = ::std::min<_DifferenceType>(__last - __first, __global_last - __first - __m_ + 1);
+        const _Tp __s_front = *__s_first_;
+        for (_DifferenceType __i = __n - 1; __i >= 0;)
+        {
+            const _Tp __front = __first[__i];
+            if (__front == __s_front && ::std::equal(__s_first_ + 1, __s_first_ + __m_, __first + (__i + 1)))
+                return __first + __i;
+            __i -= __shift_[__bucket(__front)];
+        }
+        return __last;
+    }
+};
+
+} // namespace __internal
+} // namespace dpl
+} // namespace oneapi
+
+#endif // _ONEDPL_SEARCHER_UTILS_H
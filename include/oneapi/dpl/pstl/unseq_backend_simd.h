@@ -16,9 +16,18 @@
 #ifndef _ONEDPL_UNSEQ_BACKEND_SIMD_H
 #define _ONEDPL_UNSEQ_BACKEND_SIMD_H
 
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <tuple>
 #include <type_traits>
 
 #include "utils.h"
+#include "iterator_defs.h"
+#include "iterator_impl.h"
+#include "unseq_backend_simd_x86.h"
 
 // This header defines the minimum set of vector routines required
 // to support Parallel STL.
@@ -32,13 +41,180 @@ namespace __unseq_backend
 // Expect vector width up to 64 (or 512 bit)
 const ::std::size_t __lane_size = 64;
 
+// The elements of a zip_iterator over pointers (a structure of arrays), indexed through each of the pointers
+// instead of through a copy of the iterator advanced by zip_iterator::operator[]
+template <typename... _Tp>
+class __zip_pointers
+{
+    using _ZipIterator = oneapi::dpl::zip_iterator<_Tp*...>;
+    using _Pointers = decltype(::std::declval<_ZipIterator>().base());
+
+    _Pointers __pointers_;
+
+    template <typename _DifferenceType, ::std::size_t... _Ip>
+    typename _ZipIterator::reference
+    __get(_DifferenceType __i, ::std::index_sequence<_Ip...>) const
+    {
+        return typename _ZipIterator::reference(::std::get<_Ip>(__pointers_)[__i]...);
+    }
+
+  public:
+    explicit __zip_pointers(const _ZipIterator& __it) : __pointers_(__it.base()) {}
+
+    template <typename _DifferenceType>
+    typename _ZipIterator::reference
+    operator[](_DifferenceType __i) const
+    {
+        return __get(__i, ::std::index_sequence_for<_Tp...>{});
+    }
+};
+
+// Whether _Iterator is a permutation_iterator over contiguous elements with a contiguous sequence of integer indices
+template <typename _Iterator>
+struct __is_contiguous_permutation : ::std::false_type
+{
+};
+
+template <typename _SourceIterator, typename _IndexMap>
+struct __is_contiguous_permutation<oneapi::dpl::permutation_iterator<_SourceIterator, _IndexMap>>
+    : ::std::bool_constant<!::std::is_void_v<typename __contiguous_value<_SourceIterator>::type> &&
+                           ::std::is_integral_v<typename __contiguous_value<_IndexMap>::type>>
+{
+};
+
+template <typename... _Iterators>
+inline constexpr bool __is_contiguous_permutation_v = (__is_contiguous_permutation<_Iterators>::value || ...);
+
+// The elements of a permutation_iterator over contiguous elements, indexed as __source_[__map_[__i]] so that
+// the vector loops load and store them with gathers and scatters instead of through a copy of the iterator
+// advanced by permutation_iterator::operator[]
+template <typename _SourceIterator, typename _IndexMap>
+class __permuted_elements
+{
+    _SourceIterator __source_;
+    _IndexMap __map_;
+
+  public:
+    explicit __permuted_elements(const oneapi::dpl::permutation_iterator<_SourceIterator, _IndexMap>& __it)
+        : __source_(__it.base()), __map_(__it.map())
+    {
+    }
+
+    template <typename _DifferenceType>
+    typename ::std::iterator_traits<_SourceIterator>::reference
+    operator[](_DifferenceType __i) const
+    {
+        return __source_[__map_[__i]];
+    }
+
+    template <typename _DifferenceType>
+    void
+    __prefetch(_DifferenceType __i) const
+    {
+        _ONEDPL_PREFETCH(::std::addressof(__source_[__map_[__i]]));
+    }
+};
+
+// The object indexed by the vector loops in place of the iterator __it
+template <typename _Iterator>
+_Iterator
+__simd_indexable(_Iterator __it)
+{
+    return __it;
+}
+
+template <typename... _Tp>
+__zip_pointers<_Tp...>
+__simd_indexable(oneapi::dpl::zip_iterator<_Tp*...> __it)
+{
+    return __zip_pointers<_Tp...>(__it);
+}
+
+template <typename _SourceIterator, typename _IndexMap,
+          ::std::enable_if_t<__is_contiguous_permutation_v<
+                                 oneapi::dpl::permutation_iterator<_SourceIterator, _IndexMap>>,
+                             int> = 0>
+__permuted_elements<_SourceIterator, _IndexMap>
+__simd_indexable(oneapi::dpl::permutation_iterator<_SourceIterator, _IndexMap> __it)
+{
+    return __permuted_elements<_SourceIterator, _IndexMap>(__it);
+}
+
+// Prefetches the element with the index __i of the indexables which load it through an index
+template <typename _Indexable, typename _DifferenceType>
+void
+__prefetch_at(const _Indexable&, _DifferenceType)
+{
+}
+
+template <typename _SourceIterator, typename _IndexMap, typename _DifferenceType>
+void
+__prefetch_at(const __permuted_elements<_SourceIterator, _IndexMap>& __it, _DifferenceType __i)
+{
+    __it.__prefetch(__i);
+}
+
+// Whether the serial loops over the iterators prefetch the elements of their permutation_iterators
+template <typename... _Iterators>
+inline constexpr bool __use_prefetched_walk_v =
+    _ONEDPL_PREFETCH_PRESENT && __is_contiguous_permutation_v<_Iterators...> &&
+    oneapi::dpl::__internal::__is_random_access_iterator_v<_Iterators...>;
+
+// Evaluates __f(x...) for the elements x with the same index of the sequences starting at __firsts, prefetching
+// the elements of the permutation_iterators among them ONEDPL_PREFETCH_DISTANCE indices ahead: their addresses
+// depend on the loaded indices, so the hardware prefetchers do not anticipate them.
+template <typename _DifferenceType, typename _Function, typename... _Iterators>
+void
+__prefetched_walk(_DifferenceType __n, _Function& __f, _Iterators... __firsts)
+{
+    const _DifferenceType __distance = ::std::min<_DifferenceType>(__n, ONEDPL_PREFETCH_DISTANCE);
+    auto __its = ::std::make_tuple(__simd_indexable(__firsts)...);
+    ::std::apply(
+        [__n, __distance, &__f](auto&... __it) {
+            _DifferenceType __i = 0;
+            for (; __i < __n - __distance; ++__i)
+            {
+                (__prefetch_at(__it, __i + __distance), ...);
+                __f(__it[__i]...);
+            }
+            for (; __i < __n; ++__i)
+                __f(__it[__i]...);
+        },
+        __its);
+}
+
+// Calls __f with the elements with the index __i. The elements of zip_iterator are temporary tuples of references;
+// a temporary bound to a reference in the body of a simd loop is privatized per lane into an array, which keeps the
+// loop from being vectorized, while the one created in the body of the called function is not.
+template <typename _Function, typename _DifferenceType, typename... _Indexables>
+decltype(auto)
+__simd_call_at(_Function& __f, _DifferenceType __i, _Indexables&... __its)
+{
+    return __f(__its[__i]...);
+}
+
+template <typename _Indexable, typename _DifferenceType, typename _Tp>
+void
+__simd_assign_at(_Indexable& __it, _DifferenceType __i, const _Tp& __value)
+{
+    __it[__i] = __value;
+}
+
+template <typename _Indexable, typename _DifferenceType, typename _Generator>
+void
+__simd_generate_at(_Indexable& __it, _DifferenceType __i, _Generator& __g)
+{
+    __it[__i] = __g();
+}
+
 template <class _Iterator, class _DifferenceType, class _Function>
 _Iterator
 __simd_walk_1(_Iterator __first, _DifferenceType __n, _Function __f)
 {
+    auto __it = __simd_indexable(__first);
     _ONEDPL_PRAGMA_SIMD
     for (_DifferenceType __i = 0; __i < __n; ++__i)
-        __f(__first[__i]);
+        __simd_call_at(__f, __i, __it);
 
     return __first + __n;
 }
@@ -47,9 +223,11 @@ template <class _Iterator1, class _DifferenceType, class _Iterator2, class _Func
 _Iterator2
 __simd_walk_2(_Iterator1 __first1, _DifferenceType __n, _Iterator2 __first2, _Function __f) noexcept
 {
+    auto __it1 = __simd_indexable(__first1);
+    auto __it2 = __simd_indexable(__first2);
     _ONEDPL_PRAGMA_SIMD
     for (_DifferenceType __i = 0; __i < __n; ++__i)
-        __f(__first1[__i], __first2[__i]);
+        __simd_call_at(__f, __i, __it1, __it2);
     return __first2 + __n;
 }
 
@@ -58,9 +236,12 @@ _Iterator3
 __simd_walk_3(_Iterator1 __first1, _DifferenceType __n, _Iterator2 __first2, _Iterator3 __first3,
               _Function __f) noexcept
 {
+    auto __it1 = __simd_indexable(__first1);
+    auto __it2 = __simd_indexable(__first2);
+    auto __it3 = __simd_indexable(__first3);
     _ONEDPL_PRAGMA_SIMD
     for (_DifferenceType __i = 0; __i < __n; ++__i)
-        __f(__first1[__i], __first2[__i], __first3[__i]);
+        __simd_call_at(__f, __i, __it1, __it2, __it3);
     return __first3 + __n;
 }
 
@@ -235,14 +416,59 @@ __simd_first(_Index1 __first1, _DifferenceType __n, _Index2 __first2, _Pred __pr
 #endif //_PSTL_EARLYEXIT_PRESENT || _ONEDPL_EARLYEXIT_PRESENT
 }
 
+template <class _Iterator>
+inline constexpr bool __is_volatile_reference_v =
+    ::std::is_volatile_v<::std::remove_reference_t<typename ::std::iterator_traits<_Iterator>::reference>>;
+
+// The contiguous sequences of the same integer, enumeration or pointer type without padding bits compared
+// with "==", which are equal if their bytes are
+template <class _Index1, class _Index2, class _Pred>
+inline constexpr bool __is_bytewise_equal_v =
+    (::std::is_integral_v<typename __contiguous_value<_Index1>::type> ||
+     ::std::is_enum_v<typename __contiguous_value<_Index1>::type> ||
+     ::std::is_pointer_v<typename __contiguous_value<_Index1>::type>) &&
+    ::std::has_unique_object_representations_v<typename __contiguous_value<_Index1>::type> &&
+    ::std::is_same_v<typename __contiguous_value<_Index1>::type, typename __contiguous_value<_Index2>::type> &&
+    oneapi::dpl::__internal::__is_equality_pred<_Pred, typename __contiguous_value<_Index1>::type>::value &&
+    !__is_volatile_reference_v<_Index1> && !__is_volatile_reference_v<_Index2>;
+
+template <class _Index1, class _DifferenceType, class _Index2>
+bool
+__simd_equal_bytes(_Index1 __first1, _DifferenceType __n, _Index2 __first2) noexcept
+{
+    using _Tp = typename __contiguous_value<_Index1>::type;
+    return __n <= 0 || ::std::memcmp(::std::addressof(*__first1), ::std::addressof(*__first2), __n * sizeof(_Tp)) == 0;
+}
+
+// The contiguous sequences of an unsigned byte type ordered with "<", which compare as their bytes do
+template <class _Index1, class _Index2, class _Compare>
+inline constexpr bool __is_bytewise_less_v =
+    (::std::is_same_v<typename __contiguous_value<_Index1>::type, unsigned char> ||
+     ::std::is_same_v<typename __contiguous_value<_Index1>::type, ::std::byte> ||
+     (::std::is_same_v<typename __contiguous_value<_Index1>::type, char> && !::std::is_signed_v<char>)) &&
+    ::std::is_same_v<typename __contiguous_value<_Index1>::type, typename __contiguous_value<_Index2>::type> &&
+    __is_less_pred<_Compare, typename __contiguous_value<_Index1>::type>::value &&
+    !__is_volatile_reference_v<_Index1> && !__is_volatile_reference_v<_Index2>;
+
+template <class _Index1, class _DifferenceType1, class _Index2, class _DifferenceType2>
+bool
+__simd_lexicographical_compare_bytes(_Index1 __first1, _DifferenceType1 __n1, _Index2 __first2,
+                                     _DifferenceType2 __n2) noexcept
+{
+    const ::std::size_t __n = ::std::min<::std::size_t>(__n1, __n2);
+    const int __res = __n == 0 ? 0 : ::std::memcmp(::std::addressof(*__first1), ::std::addressof(*__first2), __n);
+    return __res != 0 ? __res < 0 : __n1 < __n2;
+}
+
 template <class _Index, class _DifferenceType, class _Pred>
 _DifferenceType
 __simd_count(_Index __index, _DifferenceType __n, _Pred __pred) noexcept
 {
+    auto __it = __simd_indexable(__index);
     _DifferenceType __count = 0;
     _ONEDPL_PRAGMA_SIMD_REDUCTION(+ : __count)
     for (_DifferenceType __i = 0; __i < __n; ++__i)
-        if (__pred(*(__index + __i)))
+        if (__simd_call_at(__pred, __i, __it))
             ++__count;
 
     return __count;
@@ -283,6 +509,27 @@ __simd_assign(_InputIterator __first, _DifferenceType __n, _OutputIterator __res
     return __result + __n;
 }
 
+// The contiguous sequences of the same trivially copyable type, which copy and move assign by copying the bytes
+// unless the loops are asked to use non-temporal stores
+template <class _InputIterator, class _OutputIterator>
+inline constexpr bool __is_bytewise_copy_v =
+    !_ONEDPL_NONTEMPORAL_STORES_PRESENT && !::std::is_void_v<typename __contiguous_value<_InputIterator>::type> &&
+    ::std::is_same_v<typename __contiguous_value<_InputIterator>::type,
+                     typename __contiguous_value<_OutputIterator>::type> &&
+    ::std::is_trivially_copyable_v<typename __contiguous_value<_InputIterator>::type> &&
+    !__is_volatile_reference_v<_InputIterator> && !__is_volatile_reference_v<_OutputIterator>;
+
+template <class _InputIterator, class _DifferenceType, class _OutputIterator>
+_OutputIterator
+__simd_copy_bytes(_InputIterator __first, _DifferenceType __n, _OutputIterator __result) noexcept
+{
+    using _Tp = typename __contiguous_value<_InputIterator>::type;
+    // the C library switches to non-temporal stores for the copies larger than the cache
+    if (__n > 0)
+        ::std::memmove(__simd_kernel_output(__result), ::std::addressof(*__first), __n * sizeof(_Tp));
+    return __result + __n;
+}
+
 template <class _InputIterator, class _DifferenceType, class _OutputIterator, class _UnaryPredicate>
 _OutputIterator
 __simd_copy_if(_InputIterator __first, _DifferenceType __n, _OutputIterator __result, _UnaryPredicate __pred) noexcept
@@ -379,21 +626,50 @@ template <class _Index, class _DifferenceType, class _Tp>
 _Index
 __simd_fill_n(_Index __first, _DifferenceType __n, const _Tp& __value) noexcept
 {
+    auto __it = __simd_indexable(__first);
     _PSTL_USE_NONTEMPORAL_STORES_IF_ALLOWED
     _ONEDPL_PRAGMA_SIMD
     for (_DifferenceType __i = 0; __i < __n; ++__i)
-        __first[__i] = __value;
+        __simd_assign_at(__it, __i, __value);
     return __first + __n;
 }
 
+// The contiguous sequences of the arithmetic types and std::byte filled with a value of such a type, which
+// may be set by bytes
+template <class _Index, class _Tp>
+inline constexpr bool __is_bytewise_fill_v =
+    !_ONEDPL_NONTEMPORAL_STORES_PRESENT &&
+    (::std::is_arithmetic_v<typename __contiguous_value<_Index>::type> ||
+     ::std::is_same_v<typename __contiguous_value<_Index>::type, ::std::byte>) &&
+    (::std::is_arithmetic_v<_Tp> || ::std::is_same_v<_Tp, ::std::byte>) && !__is_volatile_reference_v<_Index>;
+
+// Sets the bytes of [__first, __first + __n) if the bytes of the value are all the same and returns whether it did
+template <class _Index, class _DifferenceType, class _Tp>
+bool
+__simd_fill_bytes(_Index __first, _DifferenceType __n, const _Tp& __value) noexcept
+{
+    using _ValueType = typename __contiguous_value<_Index>::type;
+    const _ValueType __v = static_cast<_ValueType>(__value);
+    unsigned char __bytes[sizeof(_ValueType)];
+    ::std::memcpy(__bytes, &__v, sizeof(_ValueType));
+    if (!::std::all_of(__bytes + 1, __bytes + sizeof(_ValueType),
+                       [&__bytes](unsigned char __byte) { return __byte == __bytes[0]; }))
+        return false;
+
+    if (__n > 0)
+        ::std::memset(__simd_kernel_output(__first), __bytes[0], __n * sizeof(_ValueType));
+    return true;
+}
+
 template <class _Index, class _DifferenceType, class _Generator>
 _Index
 __simd_generate_n(_Index __first, _DifferenceType __size, _Generator __g) noexcept
 {
+    auto __it = __simd_indexable(__first);
     _PSTL_USE_NONTEMPORAL_STORES_IF_ALLOWED
     _ONEDPL_PRAGMA_SIMD
     for (_DifferenceType __i = 0; __i < __size; ++__i)
-        __first[__i] = __g();
+        __simd_generate_at(__it, __i, __g);
     return __first + __size;
 }
 
@@ -0,0 +1,723 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _ONEDPL_UNSEQ_BACKEND_SIMD_X86_H
+#define _ONEDPL_UNSEQ_BACKEND_SIMD_X86_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "onedpl_config.h"
+#include "utils.h"
+
+#if _ONEDPL_SIMD_X86_AVX512 || _ONEDPL_SIMD_X86_AVX2
+#    include <immintrin.h>
+#endif
+
+// This header defines the vector kernels written with the x86 intrinsics for the contiguous sequences
+// of arithmetic values compared with the standard predicates. Unlike the pragma based loops, a kernel
+// exits on the first vector containing a match and counts the matches of a vector with a popcount.
+namespace oneapi
+{
+namespace dpl
+{
+namespace __unseq_backend
+{
+
+#if _ONEDPL_SIMD_X86_AVX512 || _ONEDPL_SIMD_X86_AVX2
+#    define _ONEDPL_SIMD_KERNELS_PRESENT 1
+#else
+#    define _ONEDPL_SIMD_KERNELS_PRESENT 0
+#endif
+
+// The arithmetic types the kernels handle; the bool values are not guaranteed to be 0 or 1 in memory
+template <typename _Tp,
+          bool = _ONEDPL_SIMD_KERNELS_PRESENT && ::std::is_arithmetic_v<_Tp> && !::std::is_same_v<_Tp, bool>>
+struct __is_simd_kernel_type : ::std::false_type
+{
+};
+
+template <typename _Tp>
+struct __is_simd_kernel_type<_Tp, true>
+    : ::std::bool_constant<(sizeof(_Tp) == 1 || sizeof(_Tp) == 2 || sizeof(_Tp) == 4 || sizeof(_Tp) == 8) &&
+                           (::std::is_integral_v<_Tp> || ::std::is_same_v<_Tp, float> ||
+                            ::std::is_same_v<_Tp, double>)>
+{
+};
+
+template <typename _Tp>
+inline constexpr bool __is_simd_kernel_type_v = __is_simd_kernel_type<_Tp>::value;
+
+template <typename _Iterator, typename _Tp,
+          bool = ::std::is_trivially_copyable_v<_Tp> && !::std::is_array_v<_Tp> && !::std::is_same_v<_Tp, bool>>
+struct __is_vector_iterator : ::std::false_type
+{
+};
+
+template <typename _Iterator, typename _Tp>
+struct __is_vector_iterator<_Iterator, _Tp, true>
+    : ::std::disjunction<::std::is_same<_Iterator, typename ::std::vector<_Tp>::iterator>,
+                         ::std::is_same<_Iterator, typename ::std::vector<_Tp>::const_iterator>>
+{
+};
+
+// The iterators over contiguous storage: the pointers and the iterators of std::vector
+template <typename _Iterator, typename = void>
+struct __contiguous_value
+{
+    using type = void;
+};
+
+template <typename _Tp>
+struct __contiguous_value<_Tp*>
+{
+    using type = ::std::remove_cv_t<_Tp>;
+};
+
+template <typename _Iterator>
+struct __contiguous_value<
+    _Iterator, ::std::enable_if_t<!::std::is_pointer_v<_Iterator> &&
+                                  __is_vector_iterator<_Iterator,
+                                                       typename ::std::iterator_traits<_Iterator>::value_type>::value>>
+{
+    using type = typename ::std::iterator_traits<_Iterator>::value_type;
+};
+
+// The value type of _Iterator if the kernels handle its elements, void otherwise
+template <typename _Iterator>
+using __simd_kernel_value_t =
+    ::std::conditional_t<__is_simd_kernel_type_v<typename __contiguous_value<_Iterator>::type>,
+                         typename __contiguous_value<_Iterator>::type, void>;
+
+// The types the compress kernels copy as blocks of bytes; the size is only taken of the object types,
+// not of the void value type of the other iterators
+template <typename _Tp, bool = _ONEDPL_SIMD_KERNELS_PRESENT && ::std::is_trivially_copyable_v<_Tp> &&
+                               !::std::is_same_v<_Tp, bool>>
+struct __is_simd_compress_type : ::std::false_type
+{
+};
+
+template <typename _Tp>
+struct __is_simd_compress_type<_Tp, true>
+    : ::std::bool_constant<sizeof(_Tp) == 4 || sizeof(_Tp) == 8 ||
+                           (_ONEDPL_SIMD_X86_AVX512_VBMI2 && (sizeof(_Tp) == 1 || sizeof(_Tp) == 2))>
+{
+};
+
+template <typename _Tp>
+inline constexpr bool __is_simd_compress_type_v = __is_simd_compress_type<_Tp>::value;
+
+template <typename _Iterator>
+const __simd_kernel_value_t<_Iterator>*
+__simd_kernel_data(_Iterator __it)
+{
+    if constexpr (::std::is_pointer_v<_Iterator>)
+        return __it;
+    else
+        return ::std::addressof(*__it);
+}
+
+template <typename _Pred, typename _Tp>
+struct __is_equal_value_pred : ::std::false_type
+{
+};
+
+template <typename _Up, typename _Tp>
+struct __is_equal_value_pred<oneapi::dpl::__internal::__equal_value<_Up>, _Tp>
+    : ::std::is_same<::std::remove_cv_t<::std::remove_reference_t<_Up>>, _Tp>
+{
+};
+
+template <typename _Pred, typename _Tp>
+struct __is_equal_pred
+    : ::std::disjunction<::std::is_same<_Pred, oneapi::dpl::__internal::__pstl_equal>,
+                         ::std::is_same<_Pred, ::std::equal_to<_Tp>>, ::std::is_same<_Pred, ::std::equal_to<>>>
+{
+};
+
+template <typename _Compare, typename _Tp>
+struct __is_less_pred
+    : ::std::disjunction<::std::is_same<_Compare, oneapi::dpl::__internal::__pstl_less>,
+                         ::std::is_same<_Compare, ::std::less<_Tp>>, ::std::is_same<_Compare, ::std::less<>>>
+{
+};
+
+template <typename _Compare, typename _Tp>
+struct __is_greater_pred
+    : ::std::disjunction<::std::is_same<_Compare, oneapi::dpl::__internal::__pstl_greater>,
+                         ::std::is_same<_Compare, ::std::greater<_Tp>>, ::std::is_same<_Compare, ::std::greater<>>>
+{
+};
+
+template <typename _Compare, typename _Tp>
+struct __is_greater_pred<oneapi::dpl::__internal::__reorder_pred<_Compare>, _Tp> : __is_less_pred<_Compare, _Tp>
+{
+};
+
+// find_if and count with the "== value" predicate
+template <typename _Iterator, typename _Pred>
+inline constexpr bool __simd_kernel_find_v =
+    __is_equal_value_pred<_Pred, __simd_kernel_value_t<_Iterator>>::value;
+
+// mismatch and equal with the "==" predicate over two sequences of the same type
+template <typename _Iterator1, typename _Iterator2, typename _Pred>
+inline constexpr bool __simd_kernel_mismatch_v =
+    !::std::is_void_v<__simd_kernel_value_t<_Iterator1>> &&
+    ::std::is_same_v<__simd_kernel_value_t<_Iterator1>, __simd_kernel_value_t<_Iterator2>> &&
+    __is_equal_pred<_Pred, __simd_kernel_value_t<_Iterator1>>::value;
+
+// copy_if, remove_if, unique_copy and partition_copy between sequences of the same type
+template <typename _Iterator1, typename _Iterator2>
+inline constexpr bool __simd_kernel_compress_v =
+    __is_simd_compress_type_v<typename __contiguous_value<_Iterator1>::type> &&
+    ::std::is_same_v<typename __contiguous_value<_Iterator1>::type, typename __contiguous_value<_Iterator2>::type>;
+
+// min_element with "<" and ">"; the floating point values are left to the generic code because of NaN
+template <typename _Iterator, typename _Compare>
+inline constexpr bool __simd_kernel_min_element_v =
+    ::std::is_integral_v<__simd_kernel_value_t<_Iterator>> &&
+    (__is_less_pred<_Compare, __simd_kernel_value_t<_Iterator>>::value ||
+     __is_greater_pred<_Compare, __simd_kernel_value_t<_Iterator>>::value);
+
+#if _ONEDPL_SIMD_KERNELS_PRESENT
+
+inline int
+__simd_ctz(::std::uint64_t __mask)
+{
+#    if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long __index;
+    _BitScanForward64(&__index, __mask);
+    return static_cast<int>(__index);
+#    else
+    return __builtin_ctzll(__mask);
+#    endif
+}
+
+inline int
+__simd_popcount(::std::uint64_t __mask)
+{
+#    if defined(_MSC_VER) && !defined(__clang__)
+    return static_cast<int>(__popcnt64(__mask));
+#    else
+    return __builtin_popcountll(__mask);
+#    endif
+}
+
+// Operations on a vector register of _Tp values. __eq returns a bit mask with __mask_bits bits per lane.
+template <typename _Tp>
+struct __simd_x86_ops
+{
+#    if _ONEDPL_SIMD_X86_AVX512
+    using __vec_type = __m512i;
+    static constexpr ::std::size_t __lanes = 64 / sizeof(_Tp);
+    static constexpr int __mask_bits = 1;
+
+    static __vec_type
+    __load(const _Tp* __p)
+    {
+        return _mm512_loadu_si512(static_cast<const void*>(__p));
+    }
+
+    static void
+    __store(_Tp* __p, __vec_type __v)
+    {
+        _mm512_storeu_si512(static_cast<void*>(__p), __v);
+    }
+
+    static __vec_type
+    __broadcast(_Tp __value)
+    {
+        if constexpr (::std::is_same_v<_Tp, float>)
+            return _mm512_castps_si512(_mm512_set1_ps(__value));
+        else if constexpr (::std::is_same_v<_Tp, double>)
+            return _mm512_castpd_si512(_mm512_set1_pd(__value));
+        else if constexpr (sizeof(_Tp) == 1)
+            return _mm512_set1_epi8(static_cast<char>(__value));
+        else if constexpr (sizeof(_Tp) == 2)
+            return _mm512_set1_epi16(static_cast<short>(__value));
+        else if constexpr (sizeof(_Tp) == 4)
+            return _mm512_set1_epi32(static_cast<int>(__value));
+        else
+            return _mm512_set1_epi64(static_cast<long long>(__value));
+    }
+
+    static ::std::uint64_t
+    __eq(__vec_type __a, __vec_type __b)
+    {
+        if constexpr (::std::is_same_v<_Tp, float>)
+            return _mm512_cmp_ps_mask(_mm512_castsi512_ps(__a), _mm512_castsi512_ps(__b), _CMP_EQ_OQ);
+        else if constexpr (::std::is_same_v<_Tp, double>)
+            return _mm512_cmp_pd_mask(_mm512_castsi512_pd(__a), _mm512_castsi512_pd(__b), _CMP_EQ_OQ);
+        else if constexpr (sizeof(_Tp) == 1)
+            return _mm512_cmpeq_epi8_mask(__a, __b);
+        else if constexpr (sizeof(_Tp) == 2)
+            return _mm512_cmpeq_epi16_mask(__a, __b);
+        else if constexpr (sizeof(_Tp) == 4)
+            return _mm512_cmpeq_epi32_mask(__a, __b);
+        else
+            return _mm512_cmpeq_epi64_mask(__a, __b);
+    }
+
+    // integral types only; a compare and a blend rather than the min and max intrinsics, which make
+    // some GCC versions warn about their undefined pass-through operand
+    static __vec_type
+    __min(__vec_type __a, __vec_type __b)
+    {
+        return __blend(__lt(__b, __a), __a, __b);
+    }
+
+    static __vec_type
+    __max(__vec_type __a, __vec_type __b)
+    {
+        return __blend(__lt(__a, __b), __a, __b);
+    }
+
+  private:
+    static ::std::uint64_t
+    __lt(__vec_type __a, __vec_type __b)
+    {
+        constexpr bool __is_signed = ::std::is_signed_v<_Tp>;
+        if constexpr (sizeof(_Tp) == 1)
+            return __is_signed ? _mm512_cmplt_epi8_mask(__a, __b) : _mm512_cmplt_epu8_mask(__a, __b);
+        else if constexpr (sizeof(_Tp) == 2)
+            return __is_signed ? _mm512_cmplt_epi16_mask(__a, __b) : _mm512_cmplt_epu16_mask(__a, __b);
+        else if constexpr (sizeof(_Tp) == 4)
+            return __is_signed ? _mm512_cmplt_epi32_mask(__a, __b) : _mm512_cmplt_epu32_mask(__a, __b);
+        else
+            return __is_signed ? _mm512_cmplt_epi64_mask(__a, __b) : _mm512_cmplt_epu64_mask(__a, __b);
+    }
+
+    // the lanes of __b where __mask is set, of __a elsewhere
+    static __vec_type
+    __blend(::std::uint64_t __mask, __vec_type __a, __vec_type __b)
+    {
+        if constexpr (sizeof(_Tp) == 1)
+            return _mm512_mask_blend_epi8(__mask, __a, __b);
+        else if constexpr (sizeof(_Tp) == 2)
+            return _mm512_mask_blend_epi16(static_cast<__mmask32>(__mask), __a, __b);
+        else if constexpr (sizeof(_Tp) == 4)
+            return _mm512_mask_blend_epi32(static_cast<__mmask16>(__mask), __a, __b);
+        else
+            return _mm512_mask_blend_epi64(static_cast<__mmask8>(__mask), __a, __b);
+    }
+#    else
+    using __vec_type = __m256i;
+    static constexpr ::std::size_t __lanes = 32 / sizeof(_Tp);
+    // the masks come from movemask_epi8, one bit per byte
+    static constexpr int __mask_bits = sizeof(_Tp);
+
+    static __vec_type
+    __load(const _Tp* __p)
+    {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(__p));
+    }
+
+    static void
+    __store(_Tp* __p, __vec_type __v)
+    {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(__p), __v);
+    }
+
+    static __vec_type
+    __broadcast(_Tp __value)
+    {
+        if constexpr (::std::is_same_v<_Tp, float>)
+            return _mm256_castps_si256(_mm256_set1_ps(__value));
+        else if constexpr (::std::is_same_v<_Tp, double>)
+            return _mm256_castpd_si256(_mm256_set1_pd(__value));
+        else if constexpr (sizeof(_Tp) == 1)
+            return _mm256_set1_epi8(static_cast<char>(__value));
+        else if constexpr (sizeof(_Tp) == 2)
+            return _mm256_set1_epi16(static_cast<short>(__value));
+        else if constexpr (sizeof(_Tp) == 4)
+            return _mm256_set1_epi32(static_cast<int>(__value));
+        else
+            return _mm256_set1_epi64x(static_cast<long long>(__value));
+    }
+
+    static ::std::uint64_t
+    __eq(__vec_type __a, __vec_type __b)
+    {
+        __m256i __eq_bytes;
+        if constexpr (::std::is_same_v<_Tp, float>)
+            __eq_bytes =
+                _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(__a), _mm256_castsi256_ps(__b), _CMP_EQ_OQ));
+        else if constexpr (::std::is_same_v<_Tp, double>)
+            __eq_bytes =
+                _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(__a), _mm256_castsi256_pd(__b), _CMP_EQ_OQ));
+        else if constexpr (sizeof(_Tp) == 1)
+            __eq_bytes = _mm256_cmpeq_epi8(__a, __b);
+        else if constexpr (sizeof(_Tp) == 2)
+            __eq_bytes = _mm256_cmpeq_epi16(__a, __b);
+        else if constexpr (sizeof(_Tp) == 4)
+            __eq_bytes = _mm256_cmpeq_epi32(__a, __b);
+        else
+            __eq_bytes = _mm256_cmpeq_epi64(__a, __b);
+        return static_cast<::std::uint32_t>(_mm256_movemask_epi8(__eq_bytes));
+    }
+
+    // integral types only
+    static __vec_type
+    __min(__vec_type __a, __vec_type __b)
+    {
+        constexpr bool __is_signed = ::std::is_signed_v<_Tp>;
+        if constexpr (sizeof(_Tp) == 1)
+            return __is_signed ? _mm256_min_epi8(__a, __b) : _mm256_min_epu8(__a, __b);
+        else if constexpr (sizeof(_Tp) == 2)
+            return __is_signed ? _mm256_min_epi16(__a, __b) : _mm256_min_epu16(__a, __b);
+        else if constexpr (sizeof(_Tp) == 4)
+            return __is_signed ? _mm256_min_epi32(__a, __b) : _mm256_min_epu32(__a, __b);
+        else
+            return _mm256_blendv_epi8(__a, __b, __gt_epi64(__a, __b));
+    }
+
+    static __vec_type
+    __max(__vec_type __a, __vec_type __b)
+    {
+        constexpr bool __is_signed = ::std::is_signed_v<_Tp>;
+        if constexpr (sizeof(_Tp) == 1)
+            return __is_signed ? _mm256_max_epi8(__a, __b) : _mm256_max_epu8(__a, __b);
+        else if constexpr (sizeof(_Tp) == 2)
+            return __is_signed ? _mm256_max_epi16(__a, __b) : _mm256_max_epu16(__a, __b);
+        else if constexpr (sizeof(_Tp) == 4)
+            return __is_signed ? _mm256_max_epi32(__a, __b) : _mm256_max_epu32(__a, __b);
+        else
+            return _mm256_blendv_epi8(__b, __a, __gt_epi64(__a, __b));
+    }
+
+  private:
+    // AVX2 has no 64-bit min and max; the unsigned values are compared with the sign bits flipped
+    static __vec_type
+    __gt_epi64(__vec_type __a, __vec_type __b)
+    {
+        if constexpr (::std::is_signed_v<_Tp>)
+            return _mm256_cmpgt_epi64(__a, __b);
+        else
+        {
+            const __m256i __sign = _mm256_set1_epi64x(static_cast<long long>(1ull << 63));
+            return _mm256_cmpgt_epi64(_mm256_xor_si256(__a, __sign), _mm256_xor_si256(__b, __sign));
+        }
+    }
+#    endif
+};
+
+// The index of the first element equal to __value, or __n
+template <typename _Tp, typename _DifferenceType>
+_DifferenceType
+__simd_kernel_find_value(const _Tp* __p, _DifferenceType __n, _Tp __value) noexcept
+{
+    using __ops = __simd_x86_ops<_Tp>;
+    constexpr _DifferenceType __lanes = __ops::__lanes;
+
+    const auto __target = __ops::__broadcast(__value);
+    _DifferenceType __i = 0;
+    for (; __i + __lanes <= __n; __i += __lanes)
+    {
+        const ::std::uint64_t __mask = __ops::__eq(__ops::__load(__p + __i), __target);
+        if (__mask)
+            return __i + __simd_ctz(__mask) / __ops::__mask_bits;
+    }
+    for (; __i < __n; ++__i)
+        if (__p[__i] == __value)
+            return __i;
+    return __n;
+}
+
+// The number of the elements equal to __value
+template <typename _Tp, typename _DifferenceType>
+_DifferenceType
+__simd_kernel_count_value(const _Tp* __p, _DifferenceType __n, _Tp __value) noexcept
+{
+    using __ops = __simd_x86_ops<_Tp>;
+    constexpr _DifferenceType __lanes = __ops::__lanes;
+
+    const auto __target = __ops::__broadcast(__value);
+    _DifferenceType __count = 0;
+    _DifferenceType __i = 0;
+    for (; __i + __lanes <= __n; __i += __lanes)
+        __count += __simd_popcount(__ops::__eq(__ops::__load(__p + __i), __target));
+    __count /= __ops::__mask_bits;
+    for (; __i < __n; ++__i)
+        __count += (__p[__i] == __value);
+    return __count;
+}
+
+// The index of the first position where the sequences differ, or __n
+template <typename _Tp, typename _DifferenceType>
+_DifferenceType
+__simd_kernel_mismatch_index(const _Tp* __p1, const _Tp* __p2, _DifferenceType __n) noexcept
+{
+    using __ops = __simd_x86_ops<_Tp>;
+    constexpr _DifferenceType __lanes = __ops::__lanes;
+    constexpr int __mask_width = __lanes * __ops::__mask_bits;
+    constexpr ::std::uint64_t __all =
+        __mask_width == 64 ? ~::std::uint64_t(0) : (::std::uint64_t(1) << (__mask_width % 64)) - 1;
+
+    _DifferenceType __i = 0;
+    for (; __i + __lanes <= __n; __i += __lanes)
+    {
+        const ::std::uint64_t __mask = ~__ops::__eq(__ops::__load(__p1 + __i), __ops::__load(__p2 + __i)) & __all;
+        if (__mask)
+            return __i + __simd_ctz(__mask) / __ops::__mask_bits;
+    }
+    for (; __i < __n; ++__i)
+        if (!(__p1[__i] == __p2[__i]))
+            return __i;
+    return __n;
+}
+
+// The index of the first minimum (or maximum if __is_max) of __n > 0 integral values: the extreme value is
+// reduced in the vector registers, then found with __simd_kernel_find_value
+template <bool __is_max, typename _Tp, typename _DifferenceType>
+_DifferenceType
+__simd_kernel_extremum(const _Tp* __p, _DifferenceType __n) noexcept
+{
+    using __ops = __simd_x86_ops<_Tp>;
+    constexpr _DifferenceType __lanes = __ops::__lanes;
+
+    _Tp __extremum = __p[0];
+    _DifferenceType __i = 0;
+    if (__n >= __lanes)
+    {
+        auto __acc = __ops::__load(__p);
+        for (__i = __lanes; __i + __lanes <= __n; __i += __lanes)
+        {
+            const auto __v = __ops::__load(__p + __i);
+            __acc = __is_max ? __ops::__max(__acc, __v) : __ops::__min(__acc, __v);
+        }
+        alignas(64) _Tp __lane_values[__lanes];
+        __ops::__store(__lane_values, __acc);
+        for (_DifferenceType __k = 0; __k < __lanes; ++__k)
+            if (__is_max ? __extremum < __lane_values[__k] : __lane_values[__k] < __extremum)
+                __extremum = __lane_values[__k];
+    }
+    for (; __i < __n; ++__i)
+        if (__is_max ? __extremum < __p[__i] : __p[__i] < __extremum)
+            __extremum = __p[__i];
+    return __simd_kernel_find_value(__p, __n, __extremum);
+}
+
+#    if !_ONEDPL_SIMD_X86_AVX512
+// The lane indices of the left-packed elements for each 8-bit mask of 32-bit lanes, one byte per lane
+struct __simd_compress_table
+{
+    ::std::uint64_t __indices[256];
+
+    constexpr __simd_compress_table() : __indices{}
+    {
+        for (unsigned __mask = 0; __mask < 256; ++__mask)
+        {
+            unsigned __k = 0;
+            for (unsigned __lane = 0; __lane < 8; ++__lane)
+                if (__mask & (1u << __lane))
+                    __indices[__mask] |= ::std::uint64_t(__lane) << (8 * __k++);
+        }
+    }
+};
+
+inline constexpr __simd_compress_table __simd_compress_indices{};
+#    endif
+
+// Copies the elements of the vector at __p with the bits of __mask set to __out, which may overlap __p
+// at a lower address, and returns their number
+template <typename _Tp>
+::std::size_t
+__simd_compress_vector(const _Tp* __p, ::std::uint64_t __mask, _Tp* __out) noexcept
+{
+#    if _ONEDPL_SIMD_X86_AVX512
+    const __m512i __v = _mm512_loadu_si512(static_cast<const void*>(__p));
+    if constexpr (sizeof(_Tp) == 8)
+        _mm512_mask_compressstoreu_epi64(static_cast<void*>(__out), static_cast<__mmask8>(__mask), __v);
+    else if constexpr (sizeof(_Tp) == 4)
+        _mm512_mask_compressstoreu_epi32(static_cast<void*>(__out), static_cast<__mmask16>(__mask), __v);
+#        if _ONEDPL_SIMD_X86_AVX512_VBMI2
+    else if constexpr (sizeof(_Tp) == 2)
+        _mm512_mask_compressstoreu_epi16(static_cast<void*>(__out), static_cast<__mmask32>(__mask), __v);
+    else
+        _mm512_mask_compressstoreu_epi8(static_cast<void*>(__out), static_cast<__mmask64>(__mask), __v);
+#        endif
+#    else
+    // the 64-bit lanes are moved as pairs of 32-bit lanes, each bit of the mask is doubled
+    const unsigned __mask32 =
+        sizeof(_Tp) == 8 ? unsigned((__mask & 1) * 3 | (__mask & 2) * 6 | (__mask & 4) * 12 | (__mask & 8) * 24)
+                         : unsigned(__mask);
+    const __m256i __v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(__p));
+    const __m256i __permutation =
+        _mm256_cvtepu8_epi32(_mm_cvtsi64_si128(static_cast<long long>(__simd_compress_indices.__indices[__mask32])));
+    // only the packed lanes are written
+    const __m256i __store_mask = _mm256_cmpgt_epi32(_mm256_set1_epi32(__simd_popcount(__mask32)),
+                                                    _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+    _mm256_maskstore_epi32(reinterpret_cast<int*>(__out), __store_mask,
+                           _mm256_permutevar8x32_epi32(__v, __permutation));
+#    endif
+    return __simd_popcount(__mask);
+}
+
+// Copies the elements __p[__i] for which __keep(__i) is true to __out_true, which may overlap __p at a lower
+// address, and the others to __out_false unless it is null; returns the numbers of the copied elements.
+// __keep is evaluated for a block of 64 elements into a bit mask, then the block is copied by vectors.
+template <typename _Tp, typename _DifferenceType, typename _Keep>
+::std::pair<_DifferenceType, _DifferenceType>
+__simd_compress(const _Tp* __p, _DifferenceType __n, _Tp* __out_true, _Tp* __out_false, _Keep __keep) noexcept
+{
+#    if _ONEDPL_SIMD_X86_AVX512
+    constexpr _DifferenceType __lanes = 64 / sizeof(_Tp);
+#    else
+    constexpr _DifferenceType __lanes = 32 / sizeof(_Tp);
+#    endif
+    constexpr ::std::uint64_t __lane_mask =
+        __lanes == 64 ? ~::std::uint64_t(0) : (::std::uint64_t(1) << (__lanes % 64)) - 1;
+    constexpr _DifferenceType __block = 64;
+
+    _DifferenceType __count_true = 0;
+    _DifferenceType __count_false = 0;
+    for (_DifferenceType __i = 0; __i < __n; __i += __block)
+    {
+        const _DifferenceType __len = __n - __i < __block ? __n - __i : __block;
+        ::std::uint64_t __bits = 0;
+        _ONEDPL_PRAGMA_SIMD_REDUCTION(| : __bits)
+        for (_DifferenceType __k = 0; __k < __len; ++__k)
+            __bits |= ::std::uint64_t(bool(__keep(__i + __k))) << __k;
+
+        _DifferenceType __k = 0;
+        for (; __k + __lanes <= __len; __k += __lanes)
+        {
+            const ::std::uint64_t __vector_bits = (__bits >> __k) & __lane_mask;
+            __count_true += __simd_compress_vector(__p + __i + __k, __vector_bits, __out_true + __count_true);
+            if (__out_false)
+                __count_false += __simd_compress_vector(__p + __i + __k, ~__vector_bits & __lane_mask,
+                                                        __out_false + __count_false);
+        }
+        for (; __k < __len; ++__k)
+        {
+            if (__bits >> __k & 1)
+                __out_true[__count_true++] = __p[__i + __k];
+            else if (__out_false)
+                __out_false[__count_false++] = __p[__i + __k];
+        }
+    }
+    return ::std::make_pair(__count_true, __count_false);
+}
+
+#endif //_ONEDPL_SIMD_KERNELS_PRESENT
+
+// Entry points used by the bricks when the corresponding __simd_kernel_*_v is true
+
+template <typename _Iterator, typename _DifferenceType, typename _Pred>
+_Iterator
+__simd_kernel_find(_Iterator __first, _DifferenceType __n, const _Pred& __pred) noexcept
+{
+#if _ONEDPL_SIMD_KERNELS_PRESENT
+    if (__n == 0)
+        return __first;
+    return __first + __simd_kernel_find_value(__simd_kernel_data(__first), __n,
+                                              __simd_kernel_value_t<_Iterator>(__pred.__get_value()));
+#else
+    return __first;
+#endif
+}
+
+template <typename _Iterator, typename _DifferenceType, typename _Pred>
+_DifferenceType
+__simd_kernel_count(_Iterator __first, _DifferenceType __n, const _Pred& __pred) noexcept
+{
+#if _ONEDPL_SIMD_KERNELS_PRESENT
+    if (__n == 0)
+        return 0;
+    return __simd_kernel_count_value(__simd_kernel_data(__first), __n,
+                                     __simd_kernel_value_t<_Iterator>(__pred.__get_value()));
+#else
+    return 0;
+#endif
+}
+
+template <typename _Iterator1, typename _DifferenceType, typename _Iterator2>
+::std::pair<_Iterator1, _Iterator2>
+__simd_kernel_mismatch(_Iterator1 __first1, _DifferenceType __n, _Iterator2 __first2) noexcept
+{
+#if _ONEDPL_SIMD_KERNELS_PRESENT
+    if (__n == 0)
+        return ::std::make_pair(__first1, __first2);
+    const _DifferenceType __i =
+        __simd_kernel_mismatch_index(__simd_kernel_data(__first1), __simd_kernel_data(__first2), __n);
+    return ::std::make_pair(__first1 + __i, __first2 + __i);
+#else
+    return ::std::make_pair(__first1, __first2);
+#endif
+}
+
+template <typename _Compare, typename _Iterator, typename _DifferenceType>
+_Iterator
+__simd_kernel_min_element(_Iterator __first, _DifferenceType __n) noexcept
+{
+#if _ONEDPL_SIMD_KERNELS_PRESENT
+    if (__n == 0)
+        return __first;
+    constexpr bool __is_max = __is_greater_pred<_Compare, __simd_kernel_value_t<_Iterator>>::value;
+    return __first + __simd_kernel_extremum<__is_max>(__simd_kernel_data(__first), __n);
+#else
+    return __first;
+#endif
+}
+
+template <typename _Iterator>
+auto*
+__simd_kernel_output(_Iterator __it)
+{
+    if constexpr (::std::is_pointer_v<_Iterator>)
+        return __it;
+    else
+        return ::std::addressof(*__it);
+}
+
+// Copies __first[__i] for which __keep(__i) is true to __result and returns the number of the copied elements;
+// __result may be __first
+template <typename _Iterator1, typename _DifferenceType, typename _Iterator2, typename _Keep>
+_DifferenceType
+__simd_kernel_compress(_Iterator1 __first, _DifferenceType __n, _Iterator2 __result, _Keep __keep) noexcept
+{
+#if _ONEDPL_SIMD_KERNELS_PRESENT
+    if (__n == 0)
+        return 0;
+    using _Tp = typename __contiguous_value<_Iterator1>::type;
+    return __simd_compress(::std::addressof(*__first), __n, __simd_kernel_output(__result), static_cast<_Tp*>(nullptr),
+                           __keep)
+        .first;
+#else
+    return 0;
+#endif
+}
+
+// Copies __first[__i] to __out_true if __keep(__i) is true and to __out_false otherwise; returns the numbers
+// of the elements copied to each of them
+template <typename _Iterator1, typename _DifferenceType, typename _Iterator2, typename _Iterator3, typename _Keep>
+::std::pair<_DifferenceType, _DifferenceType>
+__simd_kernel_partition(_Iterator1 __first, _DifferenceType __n, _Iterator2 __out_true, _Iterator3 __out_false,
+                        _Keep __keep) noexcept
+{
+#if _ONEDPL_SIMD_KERNELS_PRESENT
+    if (__n == 0)
+        return ::std::make_pair(_DifferenceType(0), _DifferenceType(0));
+    return __simd_compress(::std::addressof(*__first), __n, __simd_kernel_output(__out_true),
+                           __simd_kernel_output(__out_false), __keep);
+#else
+    return ::std::make_pair(_DifferenceType(0), _DifferenceType(0));
+#endif
+}
+
+} // namespace __unseq_backend
+} // namespace dpl
+} // namespace oneapi
+
+#endif // _ONEDPL_UNSEQ_BACKEND_SIMD_X86_H
@@ -159,6 +159,14 @@ class __pstl_equal
     }
 };
 
+// Whether _Pred is "==" for the values of _Tp
+template <typename _Pred, typename _Tp>
+struct __is_equality_pred
+    : ::std::disjunction<::std::is_same<_Pred, __pstl_equal>, ::std::is_same<_Pred, ::std::equal_to<_Tp>>,
+                         ::std::is_same<_Pred, ::std::equal_to<>>>
+{
+};
+
 //! "<" comparison.
 class __pstl_less
 {
@@ -240,6 +248,12 @@ class __equal_value
     {
         return ::std::forward<_Arg>(__arg) == _M_value;
     }
+
+    const _Tp&
+    __get_value() const
+    {
+        return _M_value;
+    }
 };
 
 //! Logical negation of ==value
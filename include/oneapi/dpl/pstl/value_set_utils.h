@@ -0,0 +1,186 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _ONEDPL_VALUE_SET_UTILS_H
+#define _ONEDPL_VALUE_SET_UTILS_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "utils.h"
+
+namespace oneapi
+{
+namespace dpl
+{
+namespace __internal
+{
+
+// The number of the values above which find_first_of looks the elements up in a __value_set of the values
+// instead of comparing each element with each of them
+inline constexpr ::std::size_t __value_set_min_size = 64;
+
+template <typename _Tp, typename = void>
+struct __is_hashable : ::std::false_type
+{
+};
+
+template <typename _Tp>
+struct __is_hashable<_Tp, ::std::void_t<decltype(::std::hash<_Tp>{}(::std::declval<const _Tp&>()))>>
+    : ::std::is_copy_constructible<_Tp>
+{
+};
+
+// Whether find_first_of with _Pred may look the elements of _Iterator1 up in a __value_set of the values
+// of _Iterator2: the value types are the same and "==" agrees with std::hash
+template <typename _Iterator1, typename _Iterator2, typename _Pred>
+inline constexpr bool __use_value_set_v =
+    ::std::is_same_v<typename ::std::iterator_traits<_Iterator1>::value_type,
+                     typename ::std::iterator_traits<_Iterator2>::value_type> &&
+    __is_hashable<typename ::std::iterator_traits<_Iterator2>::value_type>::value &&
+    __is_equality_pred<_Pred, typename ::std::iterator_traits<_Iterator2>::value_type>::value;
+
+template <typename _Size>
+bool
+__use_value_set(_Size __n)
+{
+    return __n > _Size(__value_set_min_size) &&
+           ::std::make_unsigned_t<_Size>(__n) <= ::std::numeric_limits<::std::uint32_t>::max() / 2;
+}
+
+template <typename _Tp, bool = ::std::is_integral_v<_Tp> && !::std::is_same_v<_Tp, bool>>
+struct __value_set_bitset_key
+{
+    using type = void;
+};
+
+template <typename _Tp>
+struct __value_set_bitset_key<_Tp, true>
+{
+    using type = ::std::make_unsigned_t<_Tp>;
+};
+
+// A read-only set of values with a membership test. The integers in a range of at most 64 bits per value
+// (or 65536 bits) are kept in a bitset over the range; the other values in an open-addressing hash table
+// of the indices of the distinct values, with linear probing.
+template <typename _Tp>
+class __value_set
+{
+    using _Key = typename __value_set_bitset_key<_Tp>::type;
+    static constexpr bool __is_integer = !::std::is_void_v<_Key>;
+
+    using _BitsetKey = ::std::conditional_t<__is_integer, _Key, ::std::size_t>;
+
+    ::std::vector<_Tp> __values_;
+    ::std::vector<::std::uint32_t> __slots_; // the index of the value plus one, zero for an empty slot
+    ::std::size_t __slot_mask_ = 0;
+    int __slot_shift_ = 0;
+    ::std::hash<_Tp> __hash_;
+
+    ::std::vector<::std::uint64_t> __bits_;
+    _BitsetKey __minimum_ = 0;
+    _BitsetKey __range_ = 0;
+
+    ::std::size_t
+    __slot(const _Tp& __x) const
+    {
+        // Fibonacci hashing spreads the identity hash of the integers over the table
+        return ::std::size_t((::std::uint64_t(__hash_(__x)) * 0x9E3779B97F4A7C15ull) >> __slot_shift_);
+    }
+
+    void
+    __build_bitset(_BitsetKey __minimum, _BitsetKey __range)
+    {
+        __minimum_ = __minimum;
+        __range_ = __range;
+        __bits_.assign(::std::size_t(__range_) / 64 + 1, 0);
+        for (const _Tp& __x : __values_)
+        {
+            const _BitsetKey __k = _BitsetKey(_BitsetKey(__x) - __minimum_);
+            __bits_[__k / 64] |= ::std::uint64_t(1) << (__k % 64);
+        }
+        __values_ = ::std::vector<_Tp>{};
+    }
+
+    void
+    __build_table()
+    {
+        ::std::size_t __capacity = 128;
+        __slot_shift_ = 64 - 7;
+        while (__capacity < 2 * __values_.size())
+        {
+            __capacity *= 2;
+            --__slot_shift_;
+        }
+        __slot_mask_ = __capacity - 1;
+        __slots_.assign(__capacity, 0);
+
+        for (::std::uint32_t __i = 0; __i < __values_.size(); ++__i)
+        {
+            ::std::size_t __s = __slot(__values_[__i]);
+            while (__slots_[__s] != 0 && !(__values_[__slots_[__s] - 1] == __values_[__i]))
+                __s = (__s + 1) & __slot_mask_;
+            if (__slots_[__s] == 0)
+                __slots_[__s] = __i + 1;
+        }
+    }
+
+  public:
+    template <typename _Iterator>
+    __value_set(_Iterator __first, _Iterator __last) : __values_(__first, __last)
+    {
+        if constexpr (__is_integer)
+        {
+            if (!__values_.empty())
+            {
+                const auto [__min_it, __max_it] = ::std::minmax_element(__values_.begin(), __values_.end());
+                const _BitsetKey __range = _BitsetKey(_BitsetKey(*__max_it) - _BitsetKey(*__min_it));
+                if (::std::uint64_t(__range) <
+                    ::std::max<::std::uint64_t>(::std::uint64_t(1) << 16, 64 * __values_.size()))
+                {
+                    __build_bitset(_BitsetKey(*__min_it), __range);
+                    return;
+                }
+            }
+        }
+        __build_table();
+    }
+
+    bool
+    __contains(const _Tp& __x) const
+    {
+        if constexpr (__is_integer)
+        {
+            if (!__bits_.empty())
+            {
+                const _BitsetKey __k = _BitsetKey(_BitsetKey(__x) - __minimum_);
+                return __k <= __range_ && ((__bits_[__k / 64] >> (__k % 64)) & 1) != 0;
+            }
+        }
+        for (::std::size_t __s = __slot(__x); __slots_[__s] != 0; __s = (__s + 1) & __slot_mask_)
+        {
+            if (__values_[__slots_[__s] - 1] == __x)
+                return true;
+        }
+        return false;
+    }
+};
+
+} // namespace __internal
+} // namespace dpl
+} // namespace oneapi
+
+#endif // _ONEDPL_VALUE_SET_UTILS_H
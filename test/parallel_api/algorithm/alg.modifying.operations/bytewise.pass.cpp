@@ -0,0 +1,178 @@
+// -*- C++ -*-
+//===-- bytewise.pass.cpp -------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// Tests for copy, copy_n, move, fill, fill_n, equal and lexicographical_compare over the contiguous
+// sequences of trivially copyable types, which the vectorized versions process as bytes
+#include "support/test_config.h"
+
+#include _PSTL_TEST_HEADER(execution)
+#include _PSTL_TEST_HEADER(algorithm)
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "support/utils.h"
+
+using namespace TestUtils;
+
+struct Triple
+{
+    std::int32_t a;
+    std::int16_t b;
+    std::int8_t c;
+};
+
+enum class Color : std::uint16_t
+{
+    red = 1,
+    green = 0x101,
+    blue = 0x2ff
+};
+
+template <typename T>
+std::vector<T>
+make_values(std::size_t n)
+{
+    std::vector<T> v(n);
+    for (std::size_t i = 0; i < n; ++i)
+        v[i] = T((i * 37 + 11) % 101);
+    return v;
+}
+
+std::vector<Triple>
+make_triples(std::size_t n)
+{
+    std::vector<Triple> v(n);
+    for (std::size_t i = 0; i < n; ++i)
+        v[i] = Triple{std::int32_t(i), std::int16_t(-std::int16_t(i % 1000)), std::int8_t(i % 100)};
+    return v;
+}
+
+bool
+operator==(const Triple& x, const Triple& y)
+{
+    return x.a == y.a && x.b == y.b && x.c == y.c;
+}
+
+template <typename Policy, typename T>
+void
+test_copy_move(Policy&& exec, const std::vector<T>& v)
+{
+    const std::size_t n = v.size();
+    std::vector<T> out(n + 2);
+
+    auto end = std::copy(exec, v.begin(), v.end(), out.begin() + 1);
+    EXPECT_TRUE(end == out.begin() + 1 + n, "wrong copy result");
+    EXPECT_EQ_N(v.begin(), out.begin() + 1, n, "wrong copy output");
+
+    std::vector<T> out2(n);
+    auto end2 = std::copy_n(exec, v.data(), n, out2.data());
+    EXPECT_TRUE(end2 == out2.data() + n, "wrong copy_n result");
+    EXPECT_EQ_N(v.begin(), out2.begin(), n, "wrong copy_n output");
+
+    std::vector<T> moved(n);
+    auto end3 = std::move(exec, out2.begin(), out2.end(), moved.begin());
+    EXPECT_TRUE(end3 == moved.end(), "wrong move result");
+    EXPECT_EQ_N(v.begin(), moved.begin(), n, "wrong move output");
+}
+
+template <typename Policy, typename T>
+void
+test_fill(Policy&& exec, std::size_t n, T value)
+{
+    std::vector<T> out(n + 2, T(7));
+    std::fill(exec, out.begin() + 1, out.end() - 1, value);
+    bool ok = std::memcmp(&out.front(), &out.back(), sizeof(T)) == 0;
+    for (std::size_t i = 1; i <= n; ++i)
+        ok &= std::memcmp(&out[i], &value, sizeof(T)) == 0;
+    EXPECT_TRUE(ok, "wrong fill output");
+
+    auto end = std::fill_n(exec, out.data(), n, T(3));
+    EXPECT_TRUE(end == out.data() + n, "wrong fill_n result");
+    EXPECT_TRUE(std::count(out.begin(), out.begin() + n, T(3)) == std::ptrdiff_t(n), "wrong fill_n output");
+}
+
+template <typename Policy, typename T>
+void
+test_equal_lexicographical(Policy&& exec, const std::vector<T>& v)
+{
+    std::vector<T> w(v);
+    EXPECT_TRUE(std::equal(exec, v.begin(), v.end(), w.begin()), "wrong equal result for the same values");
+    EXPECT_TRUE(std::equal(exec, v.begin(), v.end(), w.begin(), w.end()), "wrong equal result for the same values");
+    EXPECT_TRUE(!std::lexicographical_compare(exec, v.begin(), v.end(), w.begin(), w.end()),
+                "wrong lexicographical_compare result for the same values");
+    if (!v.empty())
+    {
+        EXPECT_TRUE(std::lexicographical_compare(exec, v.begin(), v.end() - 1, w.begin(), w.end()),
+                    "wrong lexicographical_compare result for a prefix");
+        EXPECT_TRUE(!std::lexicographical_compare(exec, v.begin(), v.end(), w.begin(), w.end() - 1),
+                    "wrong lexicographical_compare result against a prefix");
+    }
+    for (std::size_t pos = 0; pos < v.size(); pos += (pos < 40 ? 1 : 97))
+    {
+        w[pos] = T(v[pos] == T(0) ? 200 : 0);
+        EXPECT_TRUE(!std::equal(exec, v.begin(), v.end(), w.begin()), "wrong equal result for different values");
+        EXPECT_EQ(std::lexicographical_compare(v.begin(), v.end(), w.begin(), w.end()),
+                  std::lexicographical_compare(exec, v.begin(), v.end(), w.begin(), w.end()),
+                  "wrong lexicographical_compare result for different values");
+        w[pos] = v[pos];
+    }
+}
+
+template <typename Policy>
+void
+test_policy(Policy&& exec)
+{
+    for (std::size_t n : {0, 1, 5, 64, 1000, 100003})
+    {
+        test_copy_move(exec, make_values<std::uint8_t>(n));
+        test_copy_move(exec, make_values<std::int32_t>(n));
+        test_copy_move(exec, make_values<double>(n));
+        test_copy_move(exec, make_triples(n));
+
+        test_fill(exec, n, std::int8_t(-1));
+        test_fill(exec, n, std::int32_t(0));
+        test_fill(exec, n, std::int32_t(0x01010101));
+        test_fill(exec, n, std::int32_t(5));
+        test_fill(exec, n, std::uint64_t(-1));
+        test_fill(exec, n, 0.0f);
+        test_fill(exec, n, -0.0);
+        test_fill(exec, n, 1.5);
+        test_fill(exec, n, std::byte{0x5a});
+
+        test_equal_lexicographical(exec, make_values<unsigned char>(n));
+        test_equal_lexicographical(exec, make_values<char>(n));
+        test_equal_lexicographical(exec, make_values<std::int64_t>(n));
+
+        std::vector<Color> colors(n, Color::green);
+        if (n > 1)
+            colors[n / 2] = Color::blue;
+        std::vector<Color> colors2(colors);
+        EXPECT_TRUE(std::equal(exec, colors.begin(), colors.end(), colors2.begin()), "wrong equal result for enums");
+        if (n > 1)
+        {
+            colors2[n / 2] = Color::red;
+            EXPECT_TRUE(!std::equal(exec, colors.begin(), colors.end(), colors2.begin()),
+                        "wrong equal result for different enums");
+        }
+    }
+}
+
+int
+main()
+{
+    test_policy(oneapi::dpl::execution::seq);
+    test_policy(oneapi::dpl::execution::unseq);
+    test_policy(oneapi::dpl::execution::par);
+    test_policy(oneapi::dpl::execution::par_unseq);
+
+    return done();
+}
@@ -0,0 +1,143 @@
+// -*- C++ -*-
+//===-- gather_scatter.pass.cpp -------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// Tests for gather, scatter and the algorithms over permutation_iterator of contiguous elements with contiguous
+// indices, which the vectorized versions index with gathers and scatters and the others prefetch
+#include "support/test_config.h"
+
+#include _PSTL_TEST_HEADER(execution)
+#include _PSTL_TEST_HEADER(algorithm)
+#include _PSTL_TEST_HEADER(numeric)
+#include _PSTL_TEST_HEADER(iterator)
+
+#include <cstdint>
+#include <list>
+#include <vector>
+
+#include "support/utils.h"
+
+using namespace TestUtils;
+
+// A permutation of [0, n) with the indices spread over the whole sequence, for n which is not a multiple of 7919
+std::vector<std::int32_t>
+make_permutation(std::size_t n)
+{
+    std::vector<std::int32_t> map(n);
+    for (std::size_t i = 0; i < n; ++i)
+        map[i] = std::int32_t((i * 7919) % n);
+    return map;
+}
+
+template <typename Policy>
+void
+test_gather_scatter(Policy&& exec, std::size_t n)
+{
+    const std::vector<std::int32_t> map = make_permutation(n);
+    std::vector<double> input(n);
+    for (std::size_t i = 0; i < n; ++i)
+        input[i] = double(i) * 0.5;
+
+    std::vector<double> out(n + 1, -1.0);
+    auto end = oneapi::dpl::gather(exec, map.begin(), map.end(), input.begin(), out.begin());
+    EXPECT_TRUE(end == out.begin() + n, "wrong result from gather");
+    bool ok = out[n] == -1.0;
+    for (std::size_t i = 0; i < n; ++i)
+        ok &= out[i] == input[map[i]];
+    EXPECT_TRUE(ok, "wrong effect from gather");
+
+    std::vector<double> back(n + 1, -1.0);
+    oneapi::dpl::scatter(exec, out.data(), out.data() + n, map.data(), back.data());
+    EXPECT_EQ_N(input.begin(), back.begin(), n, "wrong effect from scatter of the gathered elements");
+    EXPECT_TRUE(back[n] == -1.0, "scatter modified an element which is not indexed");
+
+    // a map of 64-bit indices with the same index repeated
+    std::vector<std::int64_t> repeated(n, std::int64_t(n / 2));
+    std::vector<double> same(n);
+    oneapi::dpl::gather(exec, repeated.data(), repeated.data() + n, input.data(), same.data());
+    EXPECT_TRUE(std::count(same.begin(), same.end(), n ? input[n / 2] : 0.0) == std::ptrdiff_t(n),
+                "wrong effect from gather with a repeated index");
+}
+
+template <typename Policy>
+void
+test_permutation_iterator(Policy&& exec, std::size_t n)
+{
+    const std::vector<std::int32_t> map = make_permutation(n);
+    std::vector<float> x(n), values(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        x[i] = float(i % 101);
+        values[i] = float(i % 7) - 3.0f;
+    }
+    auto permuted = oneapi::dpl::make_permutation_iterator(x.data(), map.data());
+
+    std::vector<float> out(n);
+    std::transform(exec, permuted, permuted + n, out.begin(), [](float v) { return v * 2.0f; });
+    bool ok = true;
+    for (std::size_t i = 0; i < n; ++i)
+        ok &= out[i] == x[map[i]] * 2.0f;
+    EXPECT_TRUE(ok, "wrong effect from transform over permutation_iterator");
+
+    std::transform(exec, values.begin(), values.end(), permuted, out.begin(), std::plus<float>());
+    ok = true;
+    for (std::size_t i = 0; i < n; ++i)
+        ok &= out[i] == values[i] + x[map[i]];
+    EXPECT_TRUE(ok, "wrong effect from binary transform over permutation_iterator");
+
+    // a sparse matrix-vector product row: the values by the elements of x at their column indices
+    double expected_dot = 0;
+    for (std::size_t i = 0; i < n; ++i)
+        expected_dot += double(values[i]) * double(x[map[i]]);
+    double dot = std::transform_reduce(exec, values.begin(), values.end(), permuted, 0.0, std::plus<double>(),
+                                       [](float a, float b) { return double(a) * double(b); });
+    EXPECT_EQ(expected_dot, dot, "wrong result from transform_reduce over permutation_iterator");
+
+    std::vector<float> y(x);
+    auto permuted_y = oneapi::dpl::make_permutation_iterator(y.begin(), map.begin());
+    std::for_each(exec, permuted_y, permuted_y + n, [](float& v) { v += 1.0f; });
+    ok = true;
+    for (std::size_t i = 0; i < n; ++i)
+        ok &= y[i] == x[i] + 1.0f;
+    EXPECT_TRUE(ok, "wrong effect from for_each over permutation_iterator");
+
+    std::list<float> list_out(n);
+    std::copy(exec, permuted, permuted + n, list_out.begin());
+    ok = true;
+    std::size_t i = 0;
+    for (float v : list_out)
+        ok &= v == x[map[i++]];
+    EXPECT_TRUE(ok, "wrong effect from copy over permutation_iterator to a list");
+
+    // the indices computed by a functor are not a contiguous sequence
+    auto reversed = oneapi::dpl::make_permutation_iterator(x.data(), [n](std::size_t k) { return n - 1 - k; });
+    std::copy(exec, reversed, reversed + n, out.begin());
+    EXPECT_TRUE(std::equal(out.begin(), out.end(), x.rbegin()), "wrong effect from copy over a reversing permutation");
+}
+
+template <typename Policy>
+void
+test_policy(Policy&& exec)
+{
+    for (std::size_t n : {0, 1, 7, 33, 1000, 100003})
+    {
+        test_gather_scatter(exec, n);
+        test_permutation_iterator(exec, n);
+    }
+}
+
+int
+main()
+{
+    test_policy(oneapi::dpl::execution::seq);
+    test_policy(oneapi::dpl::execution::unseq);
+    test_policy(oneapi::dpl::execution::par);
+    test_policy(oneapi::dpl::execution::par_unseq);
+
+    return done();
+}
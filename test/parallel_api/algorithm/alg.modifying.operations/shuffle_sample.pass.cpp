@@ -0,0 +1,159 @@
+// -*- C++ -*-
+//===-- shuffle_sample.pass.cpp -------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "support/test_config.h"
+
+#include <oneapi/dpl/execution>
+#include <oneapi/dpl/algorithm>
+
+#include "support/utils.h"
+
+#include <numeric>
+#include <random>
+#include <vector>
+
+#if TEST_DPCPP_BACKEND_PRESENT
+#    include "support/utils_sycl.h"
+#endif
+
+using namespace TestUtils;
+
+constexpr std::uint32_t seed = 777;
+
+// The result of the serial policy is the reference: shuffle and sample must give the same result
+// for the same seed with any policy
+template <typename T>
+struct test_shuffle
+{
+    template <typename Policy, typename Iterator, typename Size>
+    ::std::enable_if_t<is_base_of_iterator_category_v<::std::random_access_iterator_tag, Iterator>>
+    operator()(Policy&& exec, Iterator first, Iterator last, Iterator expected_first, Iterator expected_last, Size n)
+    {
+        ::std::iota(first, last, T(0));
+        ::std::iota(expected_first, expected_last, T(0));
+
+        ::std::minstd_rand g(seed), expected_g(seed);
+        oneapi::dpl::shuffle(exec, first, last, g);
+        oneapi::dpl::shuffle(oneapi::dpl::execution::seq, expected_first, expected_last, expected_g);
+
+        EXPECT_EQ_N(expected_first, first, n, "wrong result from shuffle: depends on the policy");
+        EXPECT_TRUE(g == expected_g, "wrong generator state after shuffle");
+
+        ::std::sort(first, last);
+        for (Size i = 0; i < n; ++i)
+            EXPECT_TRUE(first[i] == T(i), "wrong result from shuffle: not a permutation");
+    }
+
+    template <typename Policy, typename Iterator, typename Size>
+    ::std::enable_if_t<!is_base_of_iterator_category_v<::std::random_access_iterator_tag, Iterator>>
+    operator()(Policy&&, Iterator, Iterator, Iterator, Iterator, Size)
+    {
+    }
+};
+
+template <typename T>
+struct test_sample
+{
+    template <typename Policy, typename Iterator, typename Size>
+    ::std::enable_if_t<is_base_of_iterator_category_v<::std::random_access_iterator_tag, Iterator>>
+    operator()(Policy&& exec, Iterator first, Iterator last, Iterator out_first, Iterator out_last,
+               Iterator expected_first, Iterator expected_last, Size n)
+    {
+        ::std::iota(first, last, T(0));
+        const Size k = n / 3 + 1;
+
+        ::std::minstd_rand g(seed), expected_g(seed);
+        out_last = oneapi::dpl::sample(exec, first, last, out_first, k, g);
+        expected_last = oneapi::dpl::sample(oneapi::dpl::execution::seq, first, last, expected_first, k, expected_g);
+
+        const Size expected_size = ::std::min(n, k);
+        EXPECT_TRUE(Size(out_last - out_first) == expected_size, "wrong size of the sample");
+        EXPECT_TRUE(Size(expected_last - expected_first) == expected_size, "wrong size of the sample");
+        EXPECT_EQ_N(expected_first, out_first, expected_size, "wrong result from sample: depends on the policy");
+
+        // the selected elements keep their relative order
+        for (Iterator it = out_first; it != out_last; ++it)
+        {
+            EXPECT_TRUE(*it >= T(0) && *it < T(n), "wrong result from sample: element out of the input");
+            if (it != out_first)
+                EXPECT_TRUE(*(it - 1) < *it, "wrong result from sample: order is not preserved");
+        }
+    }
+
+    template <typename Policy, typename Iterator, typename Size>
+    ::std::enable_if_t<!is_base_of_iterator_category_v<::std::random_access_iterator_tag, Iterator>>
+    operator()(Policy&&, Iterator, Iterator, Iterator, Iterator, Iterator, Iterator, Size)
+    {
+    }
+};
+
+template <typename T>
+void
+test_by_type()
+{
+    for (size_t n : TestUtils::get_pattern_for_test_sizes())
+    {
+        Sequence<T> in(n);
+        Sequence<T> out(n);
+        Sequence<T> expected(n);
+
+        invoke_on_all_host_policies()(test_shuffle<T>(), in.begin(), in.end(), expected.begin(), expected.end(), n);
+        invoke_on_all_host_policies()(test_sample<T>(), in.begin(), in.end(), out.begin(), out.end(), expected.begin(),
+                                      expected.end(), n);
+    }
+}
+
+#if TEST_DPCPP_BACKEND_PRESENT
+// Device policies with USM shared memory: the result must match the one of the host policies
+void
+test_device()
+{
+    sycl::queue q = TestUtils::get_test_queue();
+    constexpr std::size_t n = 100000;
+    constexpr std::size_t k = 1000;
+
+    std::vector<std::int32_t> expected(n);
+    std::vector<std::int32_t> expected_sample(k);
+    std::iota(expected.begin(), expected.end(), 0);
+    std::minstd_rand expected_g(seed);
+    oneapi::dpl::shuffle(oneapi::dpl::execution::par, expected.begin(), expected.end(), expected_g);
+    oneapi::dpl::sample(oneapi::dpl::execution::par, expected.begin(), expected.end(), expected_sample.begin(), k,
+                        expected_g);
+
+    std::int32_t* data = sycl::malloc_shared<std::int32_t>(n, q);
+    std::int32_t* sample = sycl::malloc_shared<std::int32_t>(k, q);
+    std::iota(data, data + n, 0);
+
+    std::minstd_rand g(seed);
+    auto policy = TestUtils::make_device_policy<class ShuffleDevice>(q);
+    oneapi::dpl::shuffle(policy, data, data + n, g);
+    EXPECT_EQ_N(expected.begin(), data, n, "wrong result from shuffle with a device policy");
+
+    auto policy2 = TestUtils::make_device_policy<class SampleDevice>(q);
+    std::int32_t* sample_last = oneapi::dpl::sample(policy2, data, data + n, sample, k, g);
+    EXPECT_TRUE(sample_last == sample + k, "wrong size of the sample with a device policy");
+    EXPECT_EQ_N(expected_sample.begin(), sample, k, "wrong result from sample with a device policy");
+
+    sycl::free(sample, q);
+    sycl::free(data, q);
+}
+#endif // TEST_DPCPP_BACKEND_PRESENT
+
+int
+main()
+{
+    test_by_type<std::int32_t>();
+    test_by_type<float64_t>();
+
+#if TEST_DPCPP_BACKEND_PRESENT
+    test_device();
+#endif
+
+    return done();
+}
@@ -0,0 +1,161 @@
+// -*- C++ -*-
+//===-- simd_compress.pass.cpp --------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// Tests for copy_if, remove_if, unique_copy, unique, partition_copy and stable_partition over the contiguous
+// sequences of trivially copyable types, which the vectorized versions process with the compress-store
+// kernels when the target instruction set has them
+#include "support/test_config.h"
+
+#include _PSTL_TEST_HEADER(execution)
+#include _PSTL_TEST_HEADER(algorithm)
+
+#include <cstdint>
+#include <vector>
+
+#include "support/utils.h"
+
+using namespace TestUtils;
+
+struct Pair32
+{
+    std::int32_t key;
+    std::int32_t value;
+
+    Pair32() = default;
+    explicit Pair32(int v) : key(v), value(-v) {}
+
+    friend bool
+    operator==(const Pair32& a, const Pair32& b)
+    {
+        return a.key == b.key && a.value == b.value;
+    }
+};
+
+template <typename T>
+int
+key_of(const T& x)
+{
+    return int(x);
+}
+
+int
+key_of(const Pair32& x)
+{
+    return x.key;
+}
+
+template <typename T>
+std::vector<T>
+make_values(std::size_t n, int runs)
+{
+    std::vector<T> v;
+    v.reserve(n);
+    for (std::size_t i = 0; i < n; ++i)
+        v.push_back(T(int((i / runs * 7 + 3) % 50)));
+    return v;
+}
+
+// Compares the first expected_last - expected_first elements
+template <typename Iterator1, typename Iterator2>
+void
+check_prefix(Iterator1 expected_first, Iterator1 expected_last, Iterator2 actual_first, const char* message)
+{
+    EXPECT_EQ_N(expected_first, actual_first, std::size_t(expected_last - expected_first), message);
+}
+
+template <typename Policy, typename T>
+void
+test_sequence(Policy&& exec, const std::vector<T>& v)
+{
+    const std::size_t n = v.size();
+    for (int threshold : {-1, 10, 25, 51})
+    {
+        auto pred = [threshold](const T& x) { return key_of(x) < threshold; };
+
+        std::vector<T> expected(n), out(n);
+        auto expected_end = std::copy_if(v.begin(), v.end(), expected.begin(), pred);
+        auto out_end = std::copy_if(exec, v.begin(), v.end(), out.begin(), pred);
+        EXPECT_EQ(expected_end - expected.begin(), out_end - out.begin(), "wrong copy_if result");
+        check_prefix(expected.begin(), expected_end, out.begin(), "wrong copy_if output");
+
+        std::vector<T> expected_false(n), out_false(n);
+        auto expected_ends = std::partition_copy(v.begin(), v.end(), expected.begin(), expected_false.begin(), pred);
+        auto out_ends = std::partition_copy(exec, v.begin(), v.end(), out.begin(), out_false.begin(), pred);
+        EXPECT_EQ(expected_ends.first - expected.begin(), out_ends.first - out.begin(),
+                  "wrong partition_copy result for the true elements");
+        EXPECT_EQ(expected_ends.second - expected_false.begin(), out_ends.second - out_false.begin(),
+                  "wrong partition_copy result for the false elements");
+        check_prefix(expected.begin(), expected_ends.first, out.begin(),
+                     "wrong partition_copy output for the true elements");
+        check_prefix(expected_false.begin(), expected_ends.second, out_false.begin(),
+                     "wrong partition_copy output for the false elements");
+
+        expected = v;
+        out = v;
+        expected_end = std::remove_if(expected.begin(), expected.end(), pred);
+        out_end = std::remove_if(exec, out.data(), out.data() + n, pred) - out.data() + out.begin();
+        EXPECT_EQ(expected_end - expected.begin(), out_end - out.begin(), "wrong remove_if result");
+        check_prefix(expected.begin(), expected_end, out.begin(), "wrong remove_if output");
+
+        expected = v;
+        out = v;
+        expected_end = std::stable_partition(expected.begin(), expected.end(), pred);
+        out_end = std::stable_partition(exec, out.begin(), out.end(), pred);
+        EXPECT_EQ(expected_end - expected.begin(), out_end - out.begin(), "wrong stable_partition result");
+        EXPECT_EQ_N(expected.begin(), out.begin(), n, "wrong stable_partition output");
+    }
+
+    std::vector<T> expected(n), out(n);
+    auto expected_end = std::unique_copy(v.begin(), v.end(), expected.begin());
+    auto out_end = std::unique_copy(exec, v.begin(), v.end(), out.begin());
+    EXPECT_EQ(expected_end - expected.begin(), out_end - out.begin(), "wrong unique_copy result");
+    check_prefix(expected.begin(), expected_end, out.begin(), "wrong unique_copy output");
+
+    expected = v;
+    out = v;
+    expected_end = std::unique(expected.begin(), expected.end());
+    out_end = std::unique(exec, out.begin(), out.end());
+    EXPECT_EQ(expected_end - expected.begin(), out_end - out.begin(), "wrong unique result");
+    check_prefix(expected.begin(), expected_end, out.begin(), "wrong unique output");
+}
+
+template <typename T, typename Policy>
+void
+test_type(Policy&& exec)
+{
+    // the sizes around the vectors and the blocks of 64 elements of the kernels
+    for (std::size_t n : {0, 1, 3, 8, 15, 16, 17, 63, 64, 65, 127, 128, 200, 1000, 10007})
+    {
+        test_sequence(exec, make_values<T>(n, 1));
+        test_sequence(exec, make_values<T>(n, 5));
+    }
+}
+
+template <typename Policy>
+void
+test_policy(Policy&& exec)
+{
+    test_type<std::int8_t>(exec);
+    test_type<std::int16_t>(exec);
+    test_type<std::int32_t>(exec);
+    test_type<std::uint32_t>(exec);
+    test_type<std::int64_t>(exec);
+    test_type<float>(exec);
+    test_type<double>(exec);
+    test_type<Pair32>(exec);
+}
+
+int
+main()
+{
+    test_policy(oneapi::dpl::execution::unseq);
+    test_policy(oneapi::dpl::execution::par_unseq);
+
+    return done();
+}
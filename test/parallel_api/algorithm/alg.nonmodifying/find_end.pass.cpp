@@ -132,6 +132,33 @@ test(const ::std::size_t bits)
     }
 }
 
+// Sequences over a small alphabet, where long subsequences occur many times and their prefixes more often
+template <typename T>
+void
+test_small_alphabet()
+{
+    const ::std::size_t n1 = 3000;
+    for (const ::std::size_t period : {2, 3, 7})
+    {
+        Sequence<T> in(n1, [=](::std::size_t i) { return T((i * i / 5) % period); });
+        for (const ::std::size_t n2 : {8, 9, 31, 64, 255})
+        {
+            for (const ::std::size_t pos : {::std::size_t(0), n1 / 3, n1 - n2})
+            {
+                Sequence<T> sub(n2, [&](::std::size_t i) { return in[pos + i]; });
+#ifdef _PSTL_TEST_FIND_END
+                invoke_on_all_policies<8>()(test_find_end<T>(), in.begin(), in.end(), sub.begin(), sub.end(),
+                                            ::std::equal_to<T>());
+#endif
+#ifdef _PSTL_TEST_SEARCH
+                invoke_on_all_policies<9>()(test_search<T>(), in.begin(), in.end(), sub.begin(), sub.end(),
+                                            ::std::equal_to<T>());
+#endif
+            }
+        }
+    }
+}
+
 template <typename T>
 struct test_non_const_find_end
 {
@@ -165,6 +192,8 @@ main()
     test<std::uint16_t>(8 * sizeof(std::uint16_t));
     test<float64_t>(53);
     test<bool>(1);
+    test_small_alphabet<std::uint8_t>();
+    test_small_alphabet<std::int64_t>();
 
 #ifdef _PSTL_TEST_FIND_END
     test_algo_basic_double<std::int32_t>(run_for_rnd_fw<test_non_const_find_end<std::int32_t>>());
@@ -101,6 +101,31 @@ test(Predicate pred)
                                 in1.begin() + max_n1 / 10, pred);
 }
 
+// Many distinct values to search for, with the elements found at several positions
+template <typename T, typename Generator>
+void
+test_many_values(Generator gen)
+{
+    const ::std::size_t n1 = 5000;
+    for (const ::std::size_t n2 : {65, 200, 3000})
+    {
+        // the elements have the odd keys and the values to search for the even ones
+        Sequence<T> in1(n1, [&](::std::size_t i) { return gen(2 * i + 1); });
+        Sequence<T> in2(n2, [&](::std::size_t i) { return gen(2 * i); });
+        invoke_on_all_policies<8>()(test_find_first_of<T>(), in1.begin(), in1.end(), in2.begin(), in2.end());
+
+        for (const ::std::size_t pos : {::std::size_t(0), n1 / 3, n1 - 1})
+        {
+            const T saved = in1[pos];
+            in1[pos] = in2[(pos * 7) % n2];
+            invoke_on_all_policies<9>()(test_find_first_of<T>(), in1.begin(), in1.end(), in2.begin(), in2.end());
+            invoke_on_all_policies<10>()(test_find_first_of_predicate<T>(), in1.begin(), in1.end(), in2.begin(),
+                                         in2.end(), ::std::equal_to<T>());
+            in1[pos] = saved;
+        }
+    }
+}
+
 template <typename T>
 struct test_non_const
 {
@@ -123,6 +148,11 @@ main()
 #endif
     test<float64_t>([](const float64_t x, const float64_t y) { return x * x == y * y; });
 
+    // a bitset over a narrow range of keys, and a hash table of the keys spread over the type
+    test_many_values<std::int32_t>([](::std::size_t k) { return std::int32_t(k) - 1000; });
+    test_many_values<std::uint64_t>([](::std::size_t k) { return std::uint64_t(k) * 0x9E3779B97F4A7C15ull; });
+    test_many_values<float64_t>([](::std::size_t k) { return float64_t(k) * 0.5; });
+
     test_algo_basic_double<std::int32_t>(run_for_rnd_fw<test_non_const<std::int32_t>>());
 
     return done();
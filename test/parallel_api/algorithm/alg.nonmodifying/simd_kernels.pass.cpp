@@ -0,0 +1,156 @@
+// -*- C++ -*-
+//===-- simd_kernels.pass.cpp ---------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// Tests for find, count, mismatch, equal, min_element and max_element over the contiguous sequences
+// of arithmetic types, which the vectorized versions process with the explicit vector kernels when
+// the target instruction set has them
+#include "support/test_config.h"
+
+#include _PSTL_TEST_HEADER(execution)
+#include _PSTL_TEST_HEADER(algorithm)
+
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <vector>
+
+#include "support/utils.h"
+
+using namespace TestUtils;
+
+template <typename T>
+std::vector<T>
+make_values(std::size_t n)
+{
+    std::vector<T> v(n);
+    for (std::size_t i = 0; i < n; ++i)
+        v[i] = T((i * 7 + 3) % 50 + 1);
+    return v;
+}
+
+template <typename Policy, typename T>
+void
+test_find_count(Policy&& exec, const std::vector<T>& v)
+{
+    for (T needle : {T(0), T(1), T(25), T(50)})
+    {
+        EXPECT_TRUE(std::find(exec, v.begin(), v.end(), needle) == std::find(v.begin(), v.end(), needle),
+                    "wrong find result");
+        EXPECT_TRUE(std::find(exec, v.data(), v.data() + v.size(), needle) ==
+                        std::find(v.data(), v.data() + v.size(), needle),
+                    "wrong find result over pointers");
+        EXPECT_EQ(std::count(v.begin(), v.end(), needle), std::count(exec, v.begin(), v.end(), needle),
+                  "wrong count result");
+    }
+}
+
+template <typename Policy, typename T>
+void
+test_mismatch_equal(Policy&& exec, const std::vector<T>& v)
+{
+    std::vector<T> w(v);
+    EXPECT_TRUE(std::equal(exec, v.begin(), v.end(), w.begin()), "wrong equal result for equal sequences");
+    EXPECT_TRUE(std::mismatch(exec, v.begin(), v.end(), w.begin()).first == v.end(),
+                "wrong mismatch result for equal sequences");
+
+    // a difference at each position of the vectors and of the tail
+    for (std::size_t pos = 0; pos < v.size(); pos += (pos < 80 ? 1 : 37))
+    {
+        w[pos] = T(w[pos] + 1);
+        EXPECT_TRUE(std::mismatch(exec, v.begin(), v.end(), w.begin(), w.end()).first == v.begin() + pos,
+                    "wrong mismatch position");
+        EXPECT_TRUE(std::mismatch(exec, v.begin(), v.end(), w.begin(), std::equal_to<>{}).first == v.begin() + pos,
+                    "wrong mismatch position with std::equal_to");
+        EXPECT_TRUE(!std::equal(exec, v.begin(), v.end(), w.begin(), w.end()), "wrong equal result");
+        w[pos] = v[pos];
+    }
+}
+
+template <typename Policy, typename T>
+void
+test_min_max(Policy&& exec, const std::vector<T>& v)
+{
+    EXPECT_TRUE(std::min_element(exec, v.begin(), v.end()) == std::min_element(v.begin(), v.end()),
+                "wrong min_element result");
+    EXPECT_TRUE(std::max_element(exec, v.begin(), v.end()) == std::max_element(v.begin(), v.end()),
+                "wrong max_element result");
+    EXPECT_TRUE(std::min_element(exec, v.begin(), v.end(), std::greater<T>{}) ==
+                    std::min_element(v.begin(), v.end(), std::greater<T>{}),
+                "wrong min_element result with std::greater");
+    EXPECT_TRUE(std::max_element(exec, v.begin(), v.end(), std::less<>{}) ==
+                    std::max_element(v.begin(), v.end(), std::less<>{}),
+                "wrong max_element result with std::less");
+}
+
+template <typename T, typename Policy>
+void
+test_type(Policy&& exec)
+{
+    for (std::size_t n : {0, 1, 7, 31, 63, 64, 65, 130, 1000, 10007})
+    {
+        std::vector<T> v = make_values<T>(n);
+        test_find_count(exec, v);
+        test_mismatch_equal(exec, v);
+        test_min_max(exec, v);
+
+        // the extreme values of the type, placed last so that the reduction over the vectors finds them
+        if (n > 2)
+        {
+            v[n - 1] = std::numeric_limits<T>::max();
+            v[n - 2] = std::numeric_limits<T>::lowest();
+            test_min_max(exec, v);
+            test_find_count(exec, v);
+        }
+    }
+}
+
+template <typename T, typename Policy>
+void
+test_floating_point(Policy&& exec)
+{
+    // NaN is not equal to itself and the zeros are equal
+    std::vector<T> v(100, T(1));
+    v[70] = std::numeric_limits<T>::quiet_NaN();
+    v[80] = T(-0.0);
+    std::vector<T> w(v);
+    EXPECT_TRUE(std::mismatch(exec, v.begin(), v.end(), w.begin()).first == v.begin() + 70,
+                "wrong mismatch result with NaN");
+    EXPECT_TRUE(std::find(exec, v.begin(), v.end(), v[70]) == v.end(), "wrong find result for NaN");
+    EXPECT_TRUE(std::find(exec, v.begin(), v.end(), T(0.0)) == v.begin() + 80, "wrong find result for -0.0");
+    EXPECT_EQ(std::ptrdiff_t(1), std::count(exec, v.begin(), v.end(), T(0.0)), "wrong count result for -0.0");
+}
+
+template <typename Policy>
+void
+test_policy(Policy&& exec)
+{
+    test_type<std::int8_t>(exec);
+    test_type<std::uint8_t>(exec);
+    test_type<char>(exec);
+    test_type<std::int16_t>(exec);
+    test_type<std::uint16_t>(exec);
+    test_type<std::int32_t>(exec);
+    test_type<std::uint32_t>(exec);
+    test_type<std::int64_t>(exec);
+    test_type<std::uint64_t>(exec);
+    test_type<float>(exec);
+    test_type<double>(exec);
+    test_floating_point<float>(exec);
+    test_floating_point<double>(exec);
+}
+
+int
+main()
+{
+    test_policy(oneapi::dpl::execution::unseq);
+    test_policy(oneapi::dpl::execution::par_unseq);
+
+    return done();
+}
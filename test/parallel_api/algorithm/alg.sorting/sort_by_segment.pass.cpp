@@ -0,0 +1,150 @@
+// -*- C++ -*-
+//===-- sort_by_segment.pass.cpp ------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "support/test_config.h"
+
+#include <oneapi/dpl/execution>
+#include <oneapi/dpl/algorithm>
+
+#include "support/utils.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#if TEST_DPCPP_BACKEND_PRESENT
+#    include "support/utils_sycl.h"
+#endif
+
+using namespace TestUtils;
+
+// The offsets of the segments with the given sizes, starting at 0 and ending at the total size
+template <typename Offset>
+std::vector<Offset>
+make_offsets(const std::vector<std::size_t>& sizes)
+{
+    std::vector<Offset> offsets(1, 0);
+    for (std::size_t size : sizes)
+        offsets.push_back(Offset(offsets.back() + size));
+    return offsets;
+}
+
+template <typename T>
+std::vector<T>
+make_keys(std::size_t n)
+{
+    std::vector<T> keys(n);
+    for (std::size_t i = 0; i < n; ++i)
+        keys[i] = T((i * 7919 + 13) % 1009);
+    return keys;
+}
+
+template <typename T, typename Offset, typename Compare>
+std::vector<T>
+sort_segments(std::vector<T> keys, const std::vector<Offset>& offsets, Compare comp)
+{
+    for (std::size_t s = 0; s + 1 < offsets.size(); ++s)
+        std::stable_sort(keys.begin() + offsets[s], keys.begin() + offsets[s + 1], comp);
+    return keys;
+}
+
+template <typename T, typename Offset, typename Policy>
+void
+test_segments(Policy&& exec, const std::vector<std::size_t>& sizes)
+{
+    const std::vector<Offset> offsets = make_offsets<Offset>(sizes);
+    const std::size_t n = offsets.back();
+    const std::vector<T> keys = make_keys<T>(n);
+
+    std::vector<T> sorted(keys);
+    oneapi::dpl::sort_by_segment(exec, sorted.begin(), sorted.end(), offsets.begin(), offsets.end());
+    const std::vector<T> expected = sort_segments(keys, offsets, std::less<T>());
+    EXPECT_EQ_N(expected.begin(), sorted.begin(), n, "wrong result from sort_by_segment");
+
+    sorted = keys;
+    oneapi::dpl::sort_by_segment(exec, sorted.data(), sorted.data() + n, offsets.data(),
+                                 offsets.data() + offsets.size(), std::greater<T>());
+    const std::vector<T> expected_greater = sort_segments(keys, offsets, std::greater<T>());
+    EXPECT_EQ_N(expected_greater.begin(), sorted.begin(), n, "wrong result from sort_by_segment with a comparator");
+}
+
+template <typename T, typename Offset, typename Policy>
+void
+test_policy(Policy&& exec)
+{
+    // no segments, and empty segments
+    test_segments<T, Offset>(exec, {});
+    test_segments<T, Offset>(exec, {0});
+    test_segments<T, Offset>(exec, {0, 0, 5, 0});
+
+    // many small segments of varying sizes
+    std::vector<std::size_t> small(10000);
+    for (std::size_t i = 0; i < small.size(); ++i)
+        small[i] = (i * 37) % 41;
+    test_segments<T, Offset>(exec, small);
+
+    // a single segment, and small segments mixed with the ones larger than sorted by a single thread
+    test_segments<T, Offset>(exec, {100003});
+    test_segments<T, Offset>(exec, {3, 40000, 1, 7, 20000, 0, 100, 70001, 2});
+}
+
+#if TEST_DPCPP_BACKEND_PRESENT
+// Device policies with USM shared memory
+void
+test_device()
+{
+    sycl::queue q = TestUtils::get_test_queue();
+
+    std::vector<std::size_t> sizes(2000);
+    for (std::size_t i = 0; i < sizes.size(); ++i)
+        sizes[i] = (i * 37) % 41;
+    sizes[1000] = 30000;
+    const std::vector<std::uint32_t> host_offsets = make_offsets<std::uint32_t>(sizes);
+    const std::size_t n = host_offsets.back();
+    const std::vector<std::int32_t> host_keys = make_keys<std::int32_t>(n);
+
+    std::int32_t* keys = sycl::malloc_shared<std::int32_t>(n, q);
+    std::uint32_t* offsets = sycl::malloc_shared<std::uint32_t>(host_offsets.size(), q);
+    std::copy(host_keys.begin(), host_keys.end(), keys);
+    std::copy(host_offsets.begin(), host_offsets.end(), offsets);
+
+    auto policy = TestUtils::make_device_policy<class SortBySegmentDevice>(q);
+    oneapi::dpl::sort_by_segment(policy, keys, keys + n, offsets, offsets + host_offsets.size(),
+                                 std::greater<std::int32_t>());
+    const std::vector<std::int32_t> expected = sort_segments(host_keys, host_offsets, std::greater<std::int32_t>());
+    EXPECT_EQ_N(expected.begin(), keys, n, "wrong result from sort_by_segment with a device policy");
+
+    sycl::free(offsets, q);
+    sycl::free(keys, q);
+}
+#endif // TEST_DPCPP_BACKEND_PRESENT
+
+template <typename T, typename Offset>
+void
+test_by_type()
+{
+    test_policy<T, Offset>(oneapi::dpl::execution::seq);
+    test_policy<T, Offset>(oneapi::dpl::execution::unseq);
+    test_policy<T, Offset>(oneapi::dpl::execution::par);
+    test_policy<T, Offset>(oneapi::dpl::execution::par_unseq);
+}
+
+int
+main()
+{
+    test_by_type<std::int32_t, std::int64_t>();
+    test_by_type<float64_t, std::uint32_t>();
+
+#if TEST_DPCPP_BACKEND_PRESENT
+    test_device();
+#endif
+
+    return done();
+}
@@ -0,0 +1,85 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "support/test_config.h"
+
+#include "oneapi/dpl/dynamic_selection"
+#include "support/test_dynamic_selection_utils.h"
+#include "support/utils.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+#if _DS_BACKEND_TBB
+using resource_t = oneapi::dpl::experimental::tbb_backend::resource_type;
+
+// The task time depends on the arena, so the profiling must end up on the fastest one
+template <bool call_select_before_submit, typename Policy>
+int
+test_auto_submit_and_wait(const std::vector<resource_t>& u, const std::vector<int>& sleep_ms, std::size_t best)
+{
+    Policy p{u};
+    const std::size_t n_samples = u.size();
+    const std::size_t N = 3 * n_samples;
+    bool pass = true;
+
+    for (std::size_t i = 1; i <= N; ++i)
+    {
+        auto f = [&](resource_t e) {
+            const std::size_t index = std::find(u.begin(), u.end(), e) - u.begin();
+            std::this_thread::sleep_for(std::chrono::milliseconds(sleep_ms[index]));
+            // we should be round-robining through the resources twice, then use the best one
+            const std::size_t expected = (i <= 2 * n_samples) ? (i - 1) % n_samples : best;
+            if (index != expected)
+                pass = false;
+        };
+        if constexpr (call_select_before_submit)
+        {
+            auto s = oneapi::dpl::experimental::select(p, f);
+            oneapi::dpl::experimental::submit_and_wait(s, f);
+        }
+        else
+        {
+            oneapi::dpl::experimental::submit_and_wait(p, f);
+        }
+    }
+    EXPECT_TRUE(pass, "ERROR: auto_tune_policy did not select the expected resources");
+    std::cout << "auto_tune submit_and_wait: OK\n";
+    return 0;
+}
+#endif // _DS_BACKEND_TBB
+
+int
+main()
+{
+    bool bProcessed = false;
+
+#if _DS_BACKEND_TBB
+    using policy_t = oneapi::dpl::experimental::auto_tune_policy<oneapi::dpl::experimental::tbb_backend>;
+    std::vector<resource_t> u;
+    for (int i = 0; i < 3; ++i)
+        u.push_back(std::make_shared<tbb::task_arena>(2, 0));
+
+    auto actual = test_initialization<policy_t, resource_t>(u);
+    EXPECT_EQ(0, actual, "ERROR: initialization test failed\n");
+    actual = test_auto_submit_and_wait<false, policy_t>(u, {40, 5, 20}, 1);
+    EXPECT_EQ(0, actual, "ERROR: auto_submit_and_wait test failed\n");
+    actual = test_auto_submit_and_wait<true, policy_t>(u, {5, 40, 20}, 0);
+    EXPECT_EQ(0, actual, "ERROR: auto_submit_and_wait test failed\n");
+    actual = test_auto_submit_and_wait<false, policy_t>(u, {40, 20, 5}, 2);
+    EXPECT_EQ(0, actual, "ERROR: auto_submit_and_wait test failed\n");
+
+    bProcessed = true;
+#endif // _DS_BACKEND_TBB
+
+    return TestUtils::done(bProcessed);
+}
@@ -0,0 +1,83 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "support/test_config.h"
+
+#include "oneapi/dpl/dynamic_selection"
+#include "support/test_dynamic_selection_utils.h"
+#include "support/utils.h"
+
+#include <atomic>
+#include <chrono>
+#include <numeric>
+
+int
+main()
+{
+    bool bProcessed = false;
+
+#if _DS_BACKEND_TBB
+    namespace ex = oneapi::dpl::experimental;
+    using policy_t = ex::deadline_policy<ex::tbb_backend>;
+    using resource_t = ex::tbb_backend::resource_type;
+    std::vector<resource_t> u;
+    for (int i = 0; i < 3; ++i)
+        u.push_back(std::make_shared<tbb::task_arena>(2, 0));
+
+    // waiting on each submission leaves only the first resource measured, and it completes first
+    auto f = [u](int i) { return u[0]; };
+
+    constexpr bool just_call_submit = false;
+    constexpr bool call_select_before_submit = true;
+
+    auto actual = test_initialization<policy_t, resource_t>(u);
+    EXPECT_EQ(0, actual, "ERROR: initialization test failed\n");
+    actual = test_select<policy_t, decltype(u), decltype(f)&, false>(u, f);
+    EXPECT_EQ(0, actual, "ERROR: select test failed\n");
+    actual = test_submit_and_wait_on_event<just_call_submit, policy_t>(u, f);
+    EXPECT_EQ(0, actual, "ERROR: submit_and_wait_on_event test failed\n");
+    actual = test_submit_and_wait_on_event<call_select_before_submit, policy_t>(u, f);
+    EXPECT_EQ(0, actual, "ERROR: submit_and_wait_on_event test failed\n");
+    actual = test_submit_and_wait<just_call_submit, policy_t>(u, f);
+    EXPECT_EQ(0, actual, "ERROR: submit_and_wait test failed\n");
+    actual = test_submit_and_wait<call_select_before_submit, policy_t>(u, f);
+    EXPECT_EQ(0, actual, "ERROR: submit_and_wait test failed\n");
+
+    // a mix of priorities and deadlines, every task runs once and its time is reported
+    policy_t p{u, 1};
+    std::atomic<int> runs{0};
+    auto task = [&runs](resource_t) { ++runs; };
+    const int n = 20;
+    for (int i = 0; i < n; ++i)
+    {
+        ex::submit(ex::select(p, ex::task_priority_t::high), task);
+        ex::submit(ex::select(p, ex::task_deadline_t{std::chrono::seconds(10)}), task);
+        ex::submit(p, task);
+        ex::submit_and_wait(ex::select(p, ex::task_priority_t::low), task);
+    }
+    ex::wait(p.get_submission_group());
+    EXPECT_EQ(4 * n, runs.load(), "ERROR: deadline_policy did not run all the tasks once");
+
+    auto t = p.get_telemetry();
+    std::uint64_t selections = 0;
+    std::uint64_t timed = 0;
+    for (auto& r : t.resources)
+    {
+        selections += r.selections;
+        timed += std::accumulate(r.latency.begin(), r.latency.end(), std::uint64_t(0));
+        EXPECT_EQ(0, int(r.in_flight), "ERROR: deadline_policy has tasks in flight after the wait");
+    }
+    EXPECT_EQ(std::uint64_t(4 * n), selections, "ERROR: wrong selections of deadline_policy");
+    EXPECT_EQ(std::uint64_t(4 * n), timed, "ERROR: wrong task times of deadline_policy");
+
+    bProcessed = true;
+#endif // _DS_BACKEND_TBB
+
+    return TestUtils::done(bProcessed);
+}
@@ -0,0 +1,241 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "support/test_config.h"
+
+#include "oneapi/dpl/dynamic_selection"
+
+// With oneTBB, the default resources are one arena per NUMA node
+#if _DS_BACKEND_TBB && __has_include(<tbb/info.h>) && !_ONEDPL_DS_TBB_NUMA_ARENAS_PRESENT
+#    error "tbb_backend does not create the default arenas per NUMA node with oneTBB"
+#endif
+
+#include "support/utils.h"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+
+#if _DS_BACKEND_TBB
+using backend_t = oneapi::dpl::experimental::tbb_backend;
+using resource_t = backend_t::resource_type;
+
+class fake_selection_handle_t
+{
+    resource_t r_;
+
+  public:
+    fake_selection_handle_t(resource_t r) : r_(r) {}
+    auto
+    unwrap()
+    {
+        return r_;
+    }
+};
+
+// Selection handle that records the reported execution info
+class reporting_selection_handle_t
+{
+    resource_t r_;
+
+  public:
+    struct counters_t
+    {
+        std::atomic<int> submissions = 0;
+        std::atomic<int> completions = 0;
+        std::atomic<int> timings = 0;
+        std::atomic<long long> total_time_ns = 0;
+    };
+    std::shared_ptr<counters_t> counters_;
+
+    reporting_selection_handle_t(resource_t r) : r_(r), counters_(std::make_shared<counters_t>()) {}
+    auto
+    unwrap()
+    {
+        return r_;
+    }
+    void
+    report(const oneapi::dpl::experimental::execution_info::task_submission_t&) const
+    {
+        ++counters_->submissions;
+    }
+    void
+    report(const oneapi::dpl::experimental::execution_info::task_completion_t&) const
+    {
+        ++counters_->completions;
+    }
+    void
+    report(const oneapi::dpl::experimental::execution_info::task_time_t&, std::chrono::nanoseconds v) const
+    {
+        ++counters_->timings;
+        counters_->total_time_ns += v.count();
+    }
+};
+
+resource_t
+make_arena()
+{
+    return std::make_shared<tbb::task_arena>(2, 0);
+}
+
+int
+test_submit_and_wait_on_submission_group()
+{
+    const int N = 100;
+    backend_t s(std::vector<resource_t>{make_arena(), make_arena()});
+    auto u = s.get_resources();
+
+    std::atomic<int> ecount = 0;
+    for (int i = 1; i <= N; ++i)
+    {
+        s.submit(fake_selection_handle_t{u[i % 2]}, [&](resource_t, int i) { ecount += i; }, i);
+    }
+    s.get_submission_group().wait();
+    EXPECT_EQ(N * (N + 1) / 2, ecount.load(), "ERROR: scheduler did not execute all tasks exactly once\n");
+
+    // an empty group
+    s.get_submission_group().wait();
+    std::cout << "wait_on_scheduler: OK\n";
+    return 0;
+}
+
+int
+test_submit_and_wait_on_submission()
+{
+    const int N = 100;
+    backend_t s(std::vector<resource_t>{make_arena()});
+    auto u = s.get_resources();
+
+    std::atomic<int> ecount = 0;
+    for (int i = 1; i <= N; ++i)
+    {
+        auto w = s.submit(fake_selection_handle_t{u[0]}, [&](resource_t, int i) { ecount += i; }, i);
+        w.wait();
+        EXPECT_EQ(i * (i + 1) / 2, ecount.load(), "ERROR: scheduler did not execute all tasks exactly once\n");
+    }
+    std::cout << "wait_on_sync: OK\n";
+    return 0;
+}
+
+int
+test_asynchronous_submission()
+{
+    backend_t s(std::vector<resource_t>{make_arena()});
+    auto u = s.get_resources();
+
+    // submit must return before the task completes
+    std::atomic<bool> release{false};
+    std::atomic<bool> done{false};
+    auto w = s.submit(fake_selection_handle_t{u[0]}, [&](resource_t r) {
+        while (!release.load())
+            std::this_thread::yield();
+        // the function is executed inside the selected arena
+        EXPECT_TRUE(tbb::this_task_arena::max_concurrency() == r->max_concurrency(),
+                    "ERROR: the function is not executed in the selected arena\n");
+        done = true;
+    });
+    EXPECT_TRUE(!done.load(), "ERROR: submit waited for the task completion\n");
+    release = true;
+    w.wait();
+    EXPECT_TRUE(done.load(), "ERROR: wait returned before the task completion\n");
+    std::cout << "asynchronous submission: OK\n";
+    return 0;
+}
+
+int
+test_reporting()
+{
+    const int N = 10;
+    backend_t s(std::vector<resource_t>{make_arena()});
+    auto u = s.get_resources();
+    reporting_selection_handle_t h{u[0]};
+
+    for (int i = 0; i < N; ++i)
+    {
+        s.submit(h, [](resource_t) { std::this_thread::sleep_for(std::chrono::milliseconds(2)); });
+    }
+    s.get_submission_group().wait();
+    EXPECT_EQ(N, h.counters_->submissions.load(), "ERROR: wrong number of reported submissions\n");
+    EXPECT_EQ(N, h.counters_->completions.load(), "ERROR: wrong number of reported completions\n");
+    EXPECT_EQ(N, h.counters_->timings.load(), "ERROR: wrong number of reported timings\n");
+    EXPECT_TRUE(h.counters_->total_time_ns.load() >= N * 2'000'000, "ERROR: reported task time is too short\n");
+    std::cout << "reporting: OK\n";
+    return 0;
+}
+
+int
+test_exception()
+{
+    backend_t s(std::vector<resource_t>{make_arena()});
+    auto u = s.get_resources();
+
+    auto w = s.submit(fake_selection_handle_t{u[0]}, [](resource_t) { throw std::runtime_error("task failed"); });
+    bool caught = false;
+    try
+    {
+        w.wait();
+    }
+    catch (const std::runtime_error&)
+    {
+        caught = true;
+    }
+    EXPECT_TRUE(caught, "ERROR: the exception of the task is not propagated by wait\n");
+    s.get_submission_group().wait();
+    std::cout << "exception: OK\n";
+    return 0;
+}
+
+int
+test_default_resources()
+{
+    backend_t s;
+    auto u = s.get_resources();
+    EXPECT_TRUE(!u.empty(), "ERROR: no default resources\n");
+#    if _ONEDPL_DS_TBB_NUMA_ARENAS_PRESENT
+    EXPECT_EQ(tbb::info::numa_nodes().size(), u.size(), "ERROR: the default resources are not one per NUMA node\n");
+#    endif
+
+    std::atomic<int> ecount = 0;
+    for (auto& r : u)
+    {
+        s.submit(fake_selection_handle_t{r}, [&](resource_t) { ++ecount; });
+    }
+    s.get_submission_group().wait();
+    EXPECT_EQ(int(u.size()), ecount.load(), "ERROR: tasks on the default resources were not executed\n");
+    std::cout << "default resources: OK\n";
+    return 0;
+}
+#endif // _DS_BACKEND_TBB
+
+int
+main()
+{
+    bool bProcessed = false;
+
+#if _DS_BACKEND_TBB
+    auto actual = test_submit_and_wait_on_submission_group();
+    EXPECT_EQ(0, actual, "ERROR: submit_and_wait_on_submission_group test failed\n");
+    actual = test_submit_and_wait_on_submission();
+    EXPECT_EQ(0, actual, "ERROR: submit_and_wait_on_submission test failed\n");
+    actual = test_asynchronous_submission();
+    EXPECT_EQ(0, actual, "ERROR: asynchronous_submission test failed\n");
+    actual = test_reporting();
+    EXPECT_EQ(0, actual, "ERROR: reporting test failed\n");
+    actual = test_exception();
+    EXPECT_EQ(0, actual, "ERROR: exception test failed\n");
+    actual = test_default_resources();
+    EXPECT_EQ(0, actual, "ERROR: default_resources test failed\n");
+
+    bProcessed = true;
+#endif // _DS_BACKEND_TBB
+
+    return TestUtils::done(bProcessed);
+}
@@ -0,0 +1,57 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "support/test_config.h"
+
+#include "oneapi/dpl/dynamic_selection"
+#include "support/test_dynamic_selection_utils.h"
+#include "support/utils.h"
+
+#include <iostream>
+
+int
+main()
+{
+    bool bProcessed = false;
+
+#if _DS_BACKEND_TBB
+    using policy_t = oneapi::dpl::experimental::round_robin_policy<oneapi::dpl::experimental::tbb_backend>;
+    using resource_t = oneapi::dpl::experimental::tbb_backend::resource_type;
+    std::vector<resource_t> u;
+    for (int i = 0; i < 3; ++i)
+        u.push_back(std::make_shared<tbb::task_arena>(2, 0));
+
+    auto n = u.size();
+    auto f = [u, n](int i) { return u[(i - 1) % n]; };
+
+    constexpr bool just_call_submit = false;
+    constexpr bool call_select_before_submit = true;
+
+    auto actual = test_initialization<policy_t, resource_t>(u);
+    EXPECT_EQ(0, actual, "ERROR: initialization test failed\n");
+    actual = test_select<policy_t, decltype(u), decltype(f)&, false>(u, f);
+    EXPECT_EQ(0, actual, "ERROR: select test failed\n");
+    actual = test_submit_and_wait_on_event<just_call_submit, policy_t>(u, f);
+    EXPECT_EQ(0, actual, "ERROR: submit_and_wait_on_event test failed\n");
+    actual = test_submit_and_wait_on_event<call_select_before_submit, policy_t>(u, f);
+    EXPECT_EQ(0, actual, "ERROR: submit_and_wait_on_event test failed\n");
+    actual = test_submit_and_wait<just_call_submit, policy_t>(u, f);
+    EXPECT_EQ(0, actual, "ERROR: submit_and_wait test failed\n");
+    actual = test_submit_and_wait<call_select_before_submit, policy_t>(u, f);
+    EXPECT_EQ(0, actual, "ERROR: submit_and_wait test failed\n");
+    actual = test_submit_and_wait_on_group<just_call_submit, policy_t>(u, f);
+    EXPECT_EQ(0, actual, "ERROR: submit_and_wait_on_group test failed\n");
+    actual = test_submit_and_wait_on_group<call_select_before_submit, policy_t>(u, f);
+    EXPECT_EQ(0, actual, "ERROR: submit_and_wait_on_group test failed\n");
+
+    bProcessed = true;
+#endif // _DS_BACKEND_TBB
+
+    return TestUtils::done(bProcessed);
+}
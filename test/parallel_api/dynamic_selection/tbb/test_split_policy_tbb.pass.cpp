@@ -0,0 +1,65 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "support/test_config.h"
+
+#include "oneapi/dpl/dynamic_selection"
+#include "support/test_dynamic_selection_utils.h"
+#include "support/utils.h"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+int
+main()
+{
+    bool bProcessed = false;
+
+#if _DS_BACKEND_TBB
+    using policy_t = oneapi::dpl::experimental::split_policy<oneapi::dpl::experimental::tbb_backend>;
+    using resource_t = oneapi::dpl::experimental::tbb_backend::resource_type;
+    std::vector<resource_t> u;
+    for (int i = 0; i < 2; ++i)
+        u.push_back(std::make_shared<tbb::task_arena>(2, 0));
+    policy_t p{u};
+
+    const std::size_t n = 100000;
+    std::vector<long long> v(n);
+    std::iota(v.begin(), v.end(), 0);
+
+    // several rounds, so that the shares follow the measured throughputs
+    for (int round = 0; round < 4; ++round)
+    {
+        long long sum = oneapi::dpl::experimental::split_reduce(p, v.begin(), v.end(), 0LL);
+        EXPECT_EQ(std::accumulate(v.begin(), v.end(), 0LL), sum, "wrong result of split_reduce");
+
+        std::vector<long long> doubled(n);
+        oneapi::dpl::experimental::split_transform(p, v.begin(), v.end(), doubled.begin(),
+                                                   [](long long x) { return 2 * x; });
+        std::vector<long long> expected(n);
+        std::transform(v.begin(), v.end(), expected.begin(), [](long long x) { return 2 * x; });
+        EXPECT_TRUE(doubled == expected, "ERROR: wrong result of split_transform\n");
+
+        oneapi::dpl::experimental::split_for_each(p, doubled.begin(), doubled.end(), [](long long& x) { x += 1; });
+        std::for_each(expected.begin(), expected.end(), [](long long& x) { x += 1; });
+        EXPECT_TRUE(doubled == expected, "ERROR: wrong result of split_for_each\n");
+
+        std::vector<long long> shuffled = v;
+        std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937(round));
+        oneapi::dpl::experimental::split_sort(p, shuffled.begin(), shuffled.end());
+        EXPECT_TRUE(shuffled == v, "ERROR: wrong result of split_sort\n");
+    }
+
+    bProcessed = true;
+#endif // _DS_BACKEND_TBB
+
+    return TestUtils::done(bProcessed);
+}
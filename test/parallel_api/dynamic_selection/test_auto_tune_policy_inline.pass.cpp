@@ -10,7 +10,11 @@
 #include "support/test_config.h"
 
 #include "oneapi/dpl/dynamic_selection"
+#include <algorithm>
+#include <cstdint>
 #include <iostream>
+#include <limits>
+#include <sstream>
 #include <thread>
 #include "support/test_dynamic_selection_utils.h"
 #include "support/inline_backend.h"
@@ -379,6 +383,350 @@ run_tests(std::vector<int> u, int best_resource)
     actual = test_auto_submit_and_wait<policy_t, decltype(u), true>(u, best_resource);
 }
 
+// busy-waits, since sleeping is not precise enough for sub-millisecond timings
+void
+spin_for(std::chrono::microseconds d)
+{
+    const auto t0 = std::chrono::steady_clock::now();
+    while (std::chrono::steady_clock::now() - t0 < d)
+    {
+    }
+}
+
+// The timings are in nanoseconds, so the resources that differ by less than a millisecond are told apart
+int
+test_sub_millisecond_timings()
+{
+    using policy_t = oneapi::dpl::experimental::auto_tune_policy<TestUtils::int_inline_backend_t>;
+    std::vector<int> u = {3, 2, 1, 4};
+    policy_t p{u};
+
+    // the timings are reported rather than measured, so that they do not depend on the clock
+    bool pass = true;
+    auto f = [](int e) { return e; };
+    for (int i = 1; i <= 12; ++i)
+    {
+        auto s = oneapi::dpl::experimental::select(p, f);
+        int e = oneapi::dpl::experimental::unwrap(s);
+        if (i > 8 && e != 1)
+            pass = false;
+        oneapi::dpl::experimental::report(s, oneapi::dpl::experimental::execution_info::task_time,
+                                          std::chrono::microseconds(e * 200));
+    }
+    EXPECT_TRUE(pass, "ERROR: did not select the fastest resource from sub-millisecond timings\n");
+    std::cout << "sub-millisecond timings: OK\n";
+    return 0;
+}
+
+// The sizes of the same order share the tuning, while a size of another order is profiled separately;
+// the profiling order of the resources tells which tuner is used
+int
+test_size_buckets()
+{
+    using policy_t = oneapi::dpl::experimental::auto_tune_policy<TestUtils::int_inline_backend_t, std::size_t>;
+    std::vector<int> u = {2, 1};
+    policy_t p{u};
+
+    bool pass = true;
+    auto f = [](int e, std::size_t) { return e; };
+    for (int i = 1; i <= 3; ++i)
+    {
+        auto s = oneapi::dpl::experimental::select(p, f, std::size_t(1000));
+        pass = pass && oneapi::dpl::experimental::unwrap(s) == u[(i - 1) % 2];
+    }
+    // same log2 bucket: the profiling goes on
+    auto s = oneapi::dpl::experimental::select(p, f, std::size_t(1020));
+    pass = pass && oneapi::dpl::experimental::unwrap(s) == u[1];
+    // another bucket: the profiling starts over
+    s = oneapi::dpl::experimental::select(p, f, std::size_t(100000));
+    pass = pass && oneapi::dpl::experimental::unwrap(s) == u[0];
+    s = oneapi::dpl::experimental::select(p, f, std::size_t(100000));
+    pass = pass && oneapi::dpl::experimental::unwrap(s) == u[1];
+
+    EXPECT_TRUE(pass, "ERROR: size buckets are not applied to the key\n");
+    std::cout << "size buckets: OK\n";
+    return 0;
+}
+
+// The buckets of the extreme values of the arguments
+int
+test_size_bucket_limits()
+{
+    using oneapi::dpl::experimental::auto_tune_key_projection;
+    bool pass = auto_tune_key_projection<std::int64_t>{}(std::numeric_limits<std::int64_t>::min()) == -64 &&
+                auto_tune_key_projection<std::int64_t>{}(std::numeric_limits<std::int64_t>::max()) == 63 &&
+                auto_tune_key_projection<std::int8_t>{}(std::int8_t(-128)) == -8 &&
+                auto_tune_key_projection<std::uint64_t>{}(std::numeric_limits<std::uint64_t>::max()) == 64 &&
+                auto_tune_key_projection<int>{}(0) == 0 && auto_tune_key_projection<int>{}(1000) == 10;
+    pass = pass && auto_tune_key_projection<double>{}(1e300) == 997 &&
+           auto_tune_key_projection<double>{}(-1e300) == -997 && auto_tune_key_projection<float>{}(1000.5f) == 10 &&
+           auto_tune_key_projection<double>{}(0.75) == 0 &&
+           auto_tune_key_projection<double>{}(std::numeric_limits<double>::infinity()) == 0 &&
+           auto_tune_key_projection<double>{}(std::numeric_limits<double>::quiet_NaN()) == 0;
+    EXPECT_TRUE(pass, "ERROR: wrong size buckets of the extreme values\n");
+    std::cout << "size bucket limits: OK\n";
+    return 0;
+}
+
+// The best resource is not fixed once found: it follows the changes of the timings
+int
+test_drifting_timings()
+{
+    using policy_t = oneapi::dpl::experimental::auto_tune_policy<TestUtils::int_inline_backend_t>;
+    std::vector<int> u = {1, 2};
+    policy_t p{u};
+
+    // the resource 1 is fast, then slow, then fast again; the resource 2 is the same all the time.
+    // The timings are reported rather than measured, in different units, so that they do not depend on the clock
+    int slow_resource = 0;
+    auto f = [](int e) { return e; };
+    // the number of selections of the resource among the last 8 ones, the others may be explorations
+    auto run = [&](int n, int resource) {
+        int count = 0;
+        for (int i = 0; i < n; ++i)
+        {
+            auto s = oneapi::dpl::experimental::select(p, f);
+            const int e = oneapi::dpl::experimental::unwrap(s);
+            if (i >= n - 8 && e == resource)
+                ++count;
+            if (e == slow_resource)
+                oneapi::dpl::experimental::report(s, oneapi::dpl::experimental::execution_info::task_time,
+                                                  std::chrono::milliseconds(5));
+            else
+                oneapi::dpl::experimental::report(s, oneapi::dpl::experimental::execution_info::task_time,
+                                                  std::chrono::duration<double, std::micro>(e * 500.0));
+        }
+        return count;
+    };
+
+    bool pass = run(12, 1) == 8;
+    slow_resource = 1;
+    pass = pass && run(32, 2) >= 7;
+    slow_resource = 0;
+    // the resource 1 is explored again while its timings are not distinct from those of the best resource
+    pass = pass && run(160, 1) >= 7;
+
+    EXPECT_TRUE(pass, "ERROR: did not follow the drift of the timings\n");
+    std::cout << "drifting timings: OK\n";
+    return 0;
+}
+
+// The selections from several threads for several functions must be valid
+int
+test_concurrent_selections()
+{
+    using policy_t = oneapi::dpl::experimental::auto_tune_policy<TestUtils::int_inline_backend_t>;
+    std::vector<int> u = {3, 1, 2};
+    policy_t p{u};
+
+    constexpr int n_threads = 4;
+    constexpr int n_tasks = 100;
+    std::atomic<int> ecount = 0;
+    std::atomic<bool> pass = true;
+    auto f1 = [&](int e) {
+        pass = pass && std::find(u.begin(), u.end(), e) != u.end();
+        ++ecount;
+        return e;
+    };
+    auto f2 = [&](int e) {
+        pass = pass && std::find(u.begin(), u.end(), e) != u.end();
+        ++ecount;
+        return e;
+    };
+    std::vector<std::thread> threads;
+    for (int t = 0; t < n_threads; ++t)
+    {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < n_tasks; ++i)
+            {
+                if (t % 2)
+                    oneapi::dpl::experimental::submit_and_wait(p, f1);
+                else
+                    oneapi::dpl::experimental::submit_and_wait(p, f2);
+            }
+        });
+    }
+    for (auto& t : threads)
+        t.join();
+    EXPECT_TRUE(pass, "ERROR: selected an unknown resource\n");
+    EXPECT_EQ(n_threads * n_tasks, ecount.load(), "ERROR: scheduler did not execute all tasks exactly once\n");
+    std::cout << "concurrent selections: OK\n";
+    return 0;
+}
+
+// The tuning exported by a policy lets another policy skip the profiling, with the resources matched
+// by their descriptors rather than their positions
+int
+test_persistent_tuning()
+{
+    using policy_t = oneapi::dpl::experimental::auto_tune_policy<TestUtils::int_inline_backend_t, std::size_t>;
+    auto f = [](int e, std::size_t) {
+        spin_for(std::chrono::microseconds(e * 100));
+        return e;
+    };
+
+    policy_t p1{std::vector<int>{3, 1, 2}};
+    for (int i = 0; i < 6; ++i)
+        oneapi::dpl::experimental::submit_and_wait(p1, f, std::size_t(1000));
+    const int best = oneapi::dpl::experimental::unwrap(oneapi::dpl::experimental::select(p1, f, std::size_t(1000)));
+    std::stringstream exported;
+    p1.export_tuning(exported);
+
+    bool pass = true;
+    {
+        std::vector<int> u = {2, 3, 1};
+        policy_t p2{u};
+        std::stringstream is(exported.str());
+        p2.import_tuning(is);
+        pass = pass && !is.fail();
+
+        // the imported keys are exported again, even if they are not selected
+        std::stringstream reexported;
+        p2.export_tuning(reexported);
+        pass = pass && reexported.str() == exported.str();
+
+        auto s = oneapi::dpl::experimental::select(p2, f, std::size_t(1020));
+        pass = pass && oneapi::dpl::experimental::unwrap(s) == best;
+        // a key that was not tuned is profiled
+        s = oneapi::dpl::experimental::select(p2, f, std::size_t(100000));
+        pass = pass && oneapi::dpl::experimental::unwrap(s) == u[0];
+    }
+    {
+        // none of the resources is known
+        std::vector<int> u = {5, 6};
+        policy_t p3{u};
+        std::stringstream is(exported.str());
+        p3.import_tuning(is);
+        auto s = oneapi::dpl::experimental::select(p3, f, std::size_t(1000));
+        pass = pass && !is.fail() && oneapi::dpl::experimental::unwrap(s) == u[0];
+    }
+    {
+        std::vector<int> u = {3, 1, 2};
+        policy_t p4{u};
+        std::stringstream is("2\n5 abc");
+        p4.import_tuning(is);
+        auto s = oneapi::dpl::experimental::select(p4, f, std::size_t(1000));
+        pass = pass && is.fail() && oneapi::dpl::experimental::unwrap(s) == u[0];
+    }
+
+    EXPECT_TRUE(pass, "ERROR: the tuning is not restored from the exported one\n");
+    std::cout << "persistent tuning: OK\n";
+    return 0;
+}
+
+int
+fast_on_1(int e)
+{
+    return e;
+}
+
+int
+fast_on_2(int e)
+{
+    return e;
+}
+
+// Two functions of the same pointer type, even passed through the same variable, have their own keys
+int
+test_function_pointers()
+{
+    using policy_t = oneapi::dpl::experimental::auto_tune_policy<TestUtils::int_inline_backend_t>;
+    std::vector<int> u = {1, 2};
+    policy_t p{u};
+
+    int (*f)(int) = nullptr;
+    // the number of selections of the fast resource among the last 8 ones
+    auto run = [&](int fast) {
+        int count = 0;
+        for (int i = 0; i < 12; ++i)
+        {
+            auto s = oneapi::dpl::experimental::select(p, f);
+            const int e = oneapi::dpl::experimental::unwrap(s);
+            if (i >= 4 && e == fast)
+                ++count;
+            oneapi::dpl::experimental::report(s, oneapi::dpl::experimental::execution_info::task_time,
+                                              std::chrono::microseconds(e == fast ? 100 : 1000));
+        }
+        return count;
+    };
+
+    f = fast_on_1;
+    bool pass = run(1) == 8;
+    f = fast_on_2;
+    pass = pass && run(2) == 8;
+    f = fast_on_1;
+    pass = pass && run(1) == 8;
+
+    EXPECT_TRUE(pass, "ERROR: the functions of the same pointer type share a key\n");
+
+    // the addresses of the functions are not stable across processes, so their keys are not exported
+    std::stringstream exported;
+    p.export_tuning(exported);
+    std::size_t n_keys = 1;
+    exported >> n_keys;
+    EXPECT_TRUE(exported && n_keys == 0, "ERROR: the tuning of a function pointer is exported\n");
+    std::cout << "function pointers: OK\n";
+    return 0;
+}
+
+// The profiling selections, the timings and the changes of the best resource are seen for each key
+int
+test_telemetry()
+{
+    using policy_t = oneapi::dpl::experimental::auto_tune_policy<TestUtils::int_inline_backend_t, std::size_t>;
+    using kind_t = oneapi::dpl::experimental::telemetry_event_kind_t;
+    std::vector<int> u = {3, 1};
+    policy_t p{u};
+
+    int n_profiling = 0, n_task_time = 0, n_selection = 0, n_best_change = 0;
+    p.set_telemetry_callback([&](const oneapi::dpl::experimental::telemetry_event_t& e) {
+        n_profiling += e.kind == kind_t::profiling;
+        n_selection += e.kind == kind_t::selection;
+        n_best_change += e.kind == kind_t::best_resource_change;
+        if (e.kind == kind_t::task_time)
+        {
+            ++n_task_time;
+            // the times are at least those of the spins
+            if (e.value < std::uint64_t(u[e.resource_index]) * 100000)
+                n_task_time = -1000;
+        }
+    });
+    auto f = [](int e, std::size_t) {
+        spin_for(std::chrono::microseconds(e * 100));
+        return e;
+    };
+    for (int i = 0; i < 6; ++i)
+        oneapi::dpl::experimental::submit_and_wait(p, f, std::size_t(10));
+    oneapi::dpl::experimental::submit_and_wait(p, f, std::size_t(1000));
+
+    auto t = p.get_telemetry();
+    bool pass = n_profiling == 5 && n_selection == 7 && n_task_time == 7 && t.resources.size() == 2 &&
+                t.keys.size() == 2;
+    std::uint64_t n_selections = 0, n_timings = 0;
+    for (const auto& r : t.resources)
+    {
+        n_selections += r.selections;
+        for (auto c : r.latency)
+            n_timings += c;
+    }
+    pass = pass && n_selections == 7 && n_timings == 7;
+    for (const auto& k : t.keys)
+    {
+        std::uint64_t n_key_timings = 0;
+        for (const auto& h : k.latency)
+            for (auto c : h)
+                n_key_timings += c;
+        // the 1st key has 2 profiling selections per resource and 2 selections of the best one
+        if (k.profiling_selections == 4)
+            pass = pass && n_key_timings == 6 && k.best_resource_changes == n_best_change;
+        else
+            pass = pass && k.profiling_selections == 1 && n_key_timings == 1 && k.best_resource_changes == 0;
+    }
+    EXPECT_TRUE(pass, "ERROR: wrong telemetry of auto_tune_policy\n");
+    std::cout << "telemetry: OK\n";
+    return 0;
+}
+
 int
 main()
 {
@@ -393,5 +741,14 @@ main()
     run_tests<policy_t>(third_resources, 1);
     run_tests<policy_t>(fourth_resources, 1);
 
+    test_sub_millisecond_timings();
+    test_size_buckets();
+    test_size_bucket_limits();
+    test_drifting_timings();
+    test_concurrent_selections();
+    test_persistent_tuning();
+    test_function_pointers();
+    test_telemetry();
+
     return TestUtils::done();
 }
@@ -0,0 +1,253 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "support/test_config.h"
+
+#include "oneapi/dpl/dynamic_selection"
+
+#include "support/test_dynamic_selection_utils.h"
+#include "support/inline_backend.h"
+#include "support/utils.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace ex = oneapi::dpl::experimental;
+using policy_t = ex::deadline_policy<TestUtils::int_inline_backend_t>;
+
+// The selections go to the resource predicted to complete first from the task times and the pending work
+int
+test_prediction()
+{
+    std::vector<int> u{4, 5};
+    policy_t p{u};
+
+    // 1000ns on the first resource, 100ns on the second one
+    auto s = ex::select(p);
+    EXPECT_TRUE(ex::unwrap(s) == 4, "ERROR: wrong first selection of deadline_policy\n");
+    ex::report(s, ex::execution_info::task_time, std::chrono::nanoseconds(1000));
+    s = ex::select(p);
+    ex::report(s, ex::execution_info::task_submission);
+    EXPECT_TRUE(ex::unwrap(s) == 4, "ERROR: deadline_policy does not predict the unmeasured resources\n");
+    s = ex::select(p);
+    EXPECT_TRUE(ex::unwrap(s) == 5, "ERROR: deadline_policy does not count the pending work\n");
+    ex::report(s, ex::execution_info::task_time, std::chrono::nanoseconds(100));
+
+    // the second resource completes 19 tasks before the first one completes its pending task and a new one
+    std::vector<ex::selection_t<policy_t>> pending;
+    for (int i = 0; i < 19; ++i)
+    {
+        pending.push_back(ex::select(p, ex::task_priority_t::high));
+        ex::report(pending.back(), ex::execution_info::task_submission);
+    }
+    bool pass = true;
+    for (auto& h : pending)
+        pass = pass && ex::unwrap(h) == 5;
+    EXPECT_TRUE(pass, "ERROR: deadline_policy does not select the fastest resource\n");
+    EXPECT_TRUE(ex::unwrap(ex::select(p)) == 4, "ERROR: deadline_policy overloads the fastest resource\n");
+    EXPECT_EQ(19, int(p.get_telemetry().resources[1].in_flight), "wrong tasks in flight of deadline_policy");
+    for (auto& h : pending)
+        ex::report(h, ex::execution_info::task_completion);
+    EXPECT_TRUE(ex::unwrap(ex::select(p)) == 5, "ERROR: deadline_policy does not count the completions\n");
+    EXPECT_EQ(0, int(p.get_telemetry().resources[1].in_flight), "wrong tasks in flight of deadline_policy");
+    return 0;
+}
+
+// The tasks that are predicted to complete after their deadline are counted
+int
+test_deadlines()
+{
+    std::vector<int> u{4, 5};
+    policy_t p{u};
+    ex::report(ex::select(p), ex::execution_info::task_time, std::chrono::nanoseconds(1000));
+
+    auto s = ex::select(p, ex::task_deadline_t{std::chrono::hours(1)});
+    EXPECT_TRUE(s.priority() == ex::task_priority_t::high, "ERROR: a task with a deadline is not urgent\n");
+    EXPECT_EQ(0, int(p.get_missed_deadlines()), "wrong missed deadlines of deadline_policy");
+    ex::select(p, ex::task_deadline_t{std::chrono::steady_clock::now() - std::chrono::seconds(1)});
+    EXPECT_EQ(1, int(p.get_missed_deadlines()), "wrong missed deadlines of deadline_policy");
+
+    // the deadline passed to submit reaches the function with the other arguments
+    int result = 0;
+    ex::submit_and_wait(
+        p, [&result](int e, ex::task_deadline_t, int x) { return result = e + x; },
+        ex::task_deadline_t{std::chrono::hours(1)}, 10);
+    EXPECT_EQ(14, result, "wrong result of a task with a deadline");
+    EXPECT_EQ(1, int(p.get_missed_deadlines()), "wrong missed deadlines of deadline_policy");
+    return 0;
+}
+
+// The low priority selections wait while all the resources are at the limit, the others do not
+int
+test_low_priority()
+{
+    std::vector<int> u{4, 5};
+    policy_t p{u, 1};
+
+    std::vector<ex::selection_t<policy_t>> low;
+    for (int i = 0; i < 2; ++i)
+    {
+        low.push_back(ex::select(p, ex::task_priority_t::low));
+        ex::report(low.back(), ex::execution_info::task_submission);
+    }
+    EXPECT_TRUE(ex::unwrap(low[0]) != ex::unwrap(low[1]), "ERROR: low priority tasks are not spread\n");
+
+    std::atomic<int> deferred{0};
+    std::thread t([&] { deferred = ex::unwrap(ex::select(p, ex::task_priority_t::low)); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(0, deferred.load(), "a low priority selection is not deferred");
+
+    ex::select(p, ex::task_priority_t::high);
+    ex::select(p);
+
+    ex::report(low[1], ex::execution_info::task_completion);
+    t.join();
+    EXPECT_EQ(ex::unwrap(low[1]), deferred.load(), "a deferred low priority selection is not resumed");
+    ex::report(low[0], ex::execution_info::task_completion);
+    return 0;
+}
+
+// A low priority selection that is dropped without being submitted gives its slot back, so the next
+// low priority selections are not deferred
+int
+test_dropped_low_priority()
+{
+    std::vector<int> u{4};
+    policy_t p{u, 1};
+
+    for (int i = 0; i < 3; ++i)
+    {
+        auto s = ex::select(p, ex::task_priority_t::low);
+        EXPECT_TRUE(ex::unwrap(s) == 4, "ERROR: wrong low priority selection of deadline_policy\n");
+    }
+
+    // a copy keeps the slot while the selection is dropped
+    std::vector<ex::selection_t<policy_t>> kept;
+    {
+        auto s = ex::select(p, ex::task_priority_t::low);
+        kept.push_back(s);
+    }
+    std::atomic<bool> selected{false};
+    std::thread t([&] {
+        ex::select(p, ex::task_priority_t::low);
+        selected = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_TRUE(!selected.load(), "ERROR: a copy of a low priority selection does not keep its slot\n");
+    kept.clear();
+    t.join();
+    EXPECT_TRUE(selected.load(), "ERROR: a dropped low priority selection keeps its slot\n");
+    return 0;
+}
+
+// A high priority task, or a task with a deadline, is not predicted to wait for the low priority tasks,
+// while a normal priority task is
+int
+test_high_priority()
+{
+    std::vector<int> u{4, 5};
+    policy_t p{u, 2};
+
+    // 1000ns on both resources
+    auto s = ex::select(p);
+    ex::report(s, ex::execution_info::task_time, std::chrono::nanoseconds(1000));
+    ex::report(s, ex::execution_info::task_submission);
+    auto s5 = ex::select(p);
+    EXPECT_TRUE(ex::unwrap(s5) == 5, "ERROR: wrong selection of deadline_policy\n");
+    ex::report(s5, ex::execution_info::task_time, std::chrono::nanoseconds(1000));
+    ex::report(s, ex::execution_info::task_completion);
+
+    // 2000ns of low priority work pending on the first resource, 1000ns of normal priority work on the second one
+    std::vector<ex::selection_t<policy_t>> pending;
+    for (auto priority : {ex::task_priority_t::low, ex::task_priority_t::normal, ex::task_priority_t::low})
+    {
+        pending.push_back(ex::select(p, priority));
+        ex::report(pending.back(), ex::execution_info::task_submission);
+    }
+    EXPECT_TRUE(ex::unwrap(pending[0]) == 4 && ex::unwrap(pending[1]) == 5 && ex::unwrap(pending[2]) == 4,
+                "ERROR: wrong selections of deadline_policy\n");
+
+    EXPECT_TRUE(ex::unwrap(ex::select(p)) == 5, "ERROR: a normal priority task does not wait for the low ones\n");
+    EXPECT_TRUE(ex::unwrap(ex::select(p, ex::task_priority_t::high)) == 4,
+                "ERROR: a high priority task waits for the low priority ones\n");
+    EXPECT_TRUE(ex::unwrap(ex::select(p, ex::task_deadline_t{std::chrono::hours(1)})) == 4,
+                "ERROR: a task with a deadline waits for the low priority ones\n");
+    EXPECT_EQ(0, int(p.get_missed_deadlines()), "wrong missed deadlines of deadline_policy");
+
+    for (auto& h : pending)
+        ex::report(h, ex::execution_info::task_completion);
+    return 0;
+}
+
+// The concurrent low priority selections never exceed the limit of a resource
+int
+test_concurrent_low_priority()
+{
+    std::vector<int> u{4, 5};
+    constexpr int limit = 2;
+    policy_t p{u, limit};
+
+    constexpr int n_threads = 8;
+    constexpr int n_tasks = 500;
+    std::atomic<int> running[2] = {0, 0};
+    std::atomic<bool> pass{true};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < n_threads; ++t)
+    {
+        threads.emplace_back([&]() {
+            for (int i = 0; i < n_tasks; ++i)
+            {
+                auto s = ex::select(p, ex::task_priority_t::low);
+                std::atomic<int>& r = running[ex::unwrap(s) - 4];
+                if (++r > limit)
+                    pass = false;
+                // other threads select between the selection and the submission
+                std::this_thread::yield();
+                ex::report(s, ex::execution_info::task_submission);
+                std::this_thread::yield();
+                --r;
+                ex::report(s, ex::execution_info::task_completion);
+            }
+        });
+    }
+    for (auto& t : threads)
+        t.join();
+    EXPECT_TRUE(pass, "ERROR: the low priority tasks exceeded the limit of deadline_policy\n");
+    EXPECT_EQ(0, int(p.get_telemetry().resources[0].in_flight + p.get_telemetry().resources[1].in_flight),
+              "wrong tasks in flight of deadline_policy");
+    return 0;
+}
+
+int
+main()
+{
+    std::vector<int> u{4, 5, 6, 7};
+    // the tasks complete at once, so the first resource is always predicted to complete first
+    auto f = [u](int i) { return u[0]; };
+
+    constexpr bool just_call_submit = false;
+    constexpr bool call_select_before_submit = true;
+
+    auto actual = test_initialization<policy_t, int>(u);
+    actual = test_select<policy_t, decltype(u), decltype(f)&, false>(u, f);
+    actual = test_submit_and_wait_on_event<just_call_submit, policy_t>(u, f);
+    actual = test_submit_and_wait_on_event<call_select_before_submit, policy_t>(u, f);
+    actual = test_submit_and_wait<just_call_submit, policy_t>(u, f);
+    actual = test_submit_and_wait<call_select_before_submit, policy_t>(u, f);
+    actual = test_prediction();
+    actual = test_deadlines();
+    actual = test_low_priority();
+    actual = test_dropped_low_priority();
+    actual = test_high_priority();
+    actual = test_concurrent_low_priority();
+
+    return TestUtils::done();
+}
@@ -15,6 +15,95 @@
 #include "support/inline_backend.h"
 #include "support/utils.h"
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+// Above 8 resources the policy compares the loads of two random resources only,
+// so the loads must stay balanced and the selections from several threads must all be valid
+int
+test_many_resources()
+{
+    using policy_t = oneapi::dpl::experimental::dynamic_load_policy<TestUtils::int_inline_backend_t>;
+    std::vector<int> u(12);
+    for (int i = 0; i < 12; ++i)
+        u[i] = i;
+    policy_t p{u};
+
+    // the tasks are not completed, so the loads only grow
+    std::vector<policy_t::selection_type> selections;
+    std::vector<int> loads(u.size(), 0);
+    for (std::size_t i = 0; i < 4 * u.size(); ++i)
+    {
+        auto s = oneapi::dpl::experimental::select(p);
+        oneapi::dpl::experimental::report(s, oneapi::dpl::experimental::execution_info::task_submission);
+        ++loads[oneapi::dpl::experimental::unwrap(s)];
+        selections.push_back(s);
+    }
+    EXPECT_TRUE(*std::max_element(loads.begin(), loads.end()) <= 8, "ERROR: loads are not balanced\n");
+    for (auto& s : selections)
+        oneapi::dpl::experimental::report(s, oneapi::dpl::experimental::execution_info::task_completion);
+
+    constexpr int n_threads = 4;
+    constexpr int n_tasks = 250;
+    std::atomic<int> ecount = 0;
+    std::atomic<bool> pass = true;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < n_threads; ++t)
+    {
+        threads.emplace_back([&]() {
+            for (int i = 0; i < n_tasks; ++i)
+            {
+                oneapi::dpl::experimental::submit_and_wait(p, [&](int e) {
+                    if (e < 0 || e >= int(u.size()))
+                        pass = false;
+                    ++ecount;
+                    return e;
+                });
+            }
+        });
+    }
+    for (auto& t : threads)
+        t.join();
+    EXPECT_TRUE(pass, "ERROR: selected an unknown resource\n");
+    EXPECT_EQ(n_threads * n_tasks, ecount.load(), "ERROR: scheduler did not execute all tasks exactly once\n");
+    std::cout << "many resources: OK\n";
+    return 0;
+}
+
+// The in-flight load is the one the policy selects by
+int
+test_telemetry()
+{
+    using policy_t = oneapi::dpl::experimental::dynamic_load_policy<TestUtils::int_inline_backend_t>;
+    std::vector<int> u{4, 5, 6};
+    policy_t p{u};
+
+    int n_events = 0;
+    p.set_telemetry_callback([&n_events](const oneapi::dpl::experimental::telemetry_event_t&) { ++n_events; });
+
+    // not completed: each selection goes to another resource
+    std::vector<policy_t::selection_type> selections;
+    for (int i = 0; i < 4; ++i)
+    {
+        auto s = oneapi::dpl::experimental::select(p);
+        oneapi::dpl::experimental::report(s, oneapi::dpl::experimental::execution_info::task_submission);
+        selections.push_back(s);
+    }
+    auto t = p.get_telemetry();
+    bool pass = n_events == 4 && t.resources.size() == 3 && t.resources[0].selections == 2 &&
+                t.resources[0].in_flight == 2 && t.resources[1].in_flight == 1 && t.resources[2].in_flight == 1;
+
+    for (auto& s : selections)
+        oneapi::dpl::experimental::report(s, oneapi::dpl::experimental::execution_info::task_completion);
+    t = p.get_telemetry();
+    pass = pass && t.resources[0].in_flight == 0 && t.resources[1].selections == 1;
+    EXPECT_TRUE(pass, "ERROR: wrong telemetry of dynamic_load_policy\n");
+    std::cout << "telemetry: OK\n";
+    return 0;
+}
+
 int
 main()
 {
@@ -36,6 +125,8 @@ main()
     actual = test_submit_and_wait<call_select_before_submit, policy_t>(u, f);
     actual = test_submit_and_wait_on_group<just_call_submit, policy_t>(u, f);
     actual = test_submit_and_wait_on_group<call_select_before_submit, policy_t>(u, f);
+    actual = test_many_resources();
+    actual = test_telemetry();
 
     return TestUtils::done();
 }
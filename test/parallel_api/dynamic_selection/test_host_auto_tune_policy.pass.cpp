@@ -0,0 +1,132 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "support/test_config.h"
+
+#include "oneapi/dpl/dynamic_selection"
+#include "oneapi/dpl/numeric"
+
+#include <chrono>
+#include <numeric>
+#include <sstream>
+#include <type_traits>
+#include <vector>
+#include "support/utils.h"
+
+namespace ex = oneapi::dpl::experimental;
+
+static void
+spin_for(std::chrono::microseconds d)
+{
+    const auto t0 = std::chrono::steady_clock::now();
+    while (std::chrono::steady_clock::now() - t0 < d)
+    {
+    }
+}
+
+template <typename ExecutionPolicy>
+constexpr bool is_seq_v = std::is_same_v<std::decay_t<ExecutionPolicy>, oneapi::dpl::execution::sequenced_policy>;
+
+// The results of the calls do not depend on the selected policy, and each policy is profiled
+int
+test_results()
+{
+    ex::host_auto_tune_policy p;
+    EXPECT_EQ(4, int(p.get_resources().size()), "wrong number of host policies");
+
+    std::vector<int> v(1000);
+    std::iota(v.begin(), v.end(), 0);
+    for (int i = 0; i < 10; ++i)
+    {
+        long sum = ex::invoke_with_host_policy(p, v.size(), [&v](auto&& exec) {
+            return oneapi::dpl::reduce(exec, v.begin(), v.end(), 0L);
+        });
+        EXPECT_EQ(999L * 1000 / 2, sum, "wrong result of a reduction with a selected host policy");
+    }
+
+    auto t = p.get_telemetry();
+    bool pass = t.keys.size() == 1;
+    for (auto& r : t.resources)
+        pass = pass && r.selections >= 2;
+    EXPECT_TRUE(pass, "ERROR: the host policies are not all profiled\n");
+
+    // submit passes the policy and the key arguments to the function
+    std::size_t seen = 0;
+    auto f = [&seen](auto&& exec, std::size_t n) { seen = n; };
+    ex::submit_and_wait(p, f, std::size_t(7));
+    EXPECT_EQ(std::size_t(7), seen, "wrong arguments of a function submitted with a host policy");
+    std::cout << "results: OK\n";
+    return 0;
+}
+
+// The crossover size of a call site is learned: the sequential policy is the fastest for the small sizes only
+template <typename Policy>
+bool
+run_call_site(Policy& p, std::size_t n)
+{
+    bool used_seq = false;
+    ex::invoke_with_host_policy(p, n, [n, &used_seq](auto&& exec) {
+        used_seq = is_seq_v<decltype(exec)>;
+        // the parallel policies have a fixed overhead, the sequential one is linear in the size
+        spin_for(std::chrono::microseconds(used_seq ? n * 20 : 2000));
+    });
+    return used_seq;
+}
+
+int
+test_crossover()
+{
+    ex::host_auto_tune_policy p;
+
+    // the resources are profiled twice each, then the fastest one is used
+    bool pass = true;
+    for (int i = 0; i < 14; ++i)
+    {
+        bool small_seq = run_call_site(p, 8);
+        bool large_seq = run_call_site(p, 1024);
+        if (i >= 8)
+            pass = pass && small_seq && !large_seq;
+    }
+    EXPECT_TRUE(pass, "ERROR: the crossover size of the call site is not learned\n");
+
+    // the learned policies are exported by their names
+    std::ostringstream os;
+    p.export_tuning(os);
+    EXPECT_TRUE(os.str().find("par") != std::string::npos && os.str().find("seq") != std::string::npos,
+                "ERROR: the host policies are not exported by their names\n");
+    std::cout << "crossover: OK\n";
+    return 0;
+}
+
+// A subset of the host policies can be given
+int
+test_subset()
+{
+    ex::host_auto_tune_policy p{{ex::host_policy_t::seq, ex::host_policy_t::unseq}};
+    for (int i = 0; i < 6; ++i)
+    {
+        bool given = ex::invoke_with_host_policy(p, 4, [](auto&& exec) {
+            using policy_t = std::decay_t<decltype(exec)>;
+            return is_seq_v<policy_t> || std::is_same_v<policy_t, oneapi::dpl::execution::unsequenced_policy>;
+        });
+        EXPECT_TRUE(given, "ERROR: a host policy out of the given ones is selected\n");
+    }
+    std::cout << "subset: OK\n";
+    return 0;
+}
+
+int
+main()
+{
+    test_results();
+    test_crossover();
+    test_subset();
+
+    return TestUtils::done();
+}
@@ -15,6 +15,82 @@
 #include "support/inline_backend.h"
 #include "support/utils.h"
 
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+// The selections are spread evenly, and each of them is passed to the callback
+int
+test_telemetry()
+{
+    using policy_t = oneapi::dpl::experimental::round_robin_policy<TestUtils::int_inline_backend_t>;
+    std::vector<int> u{4, 5, 6, 7};
+    policy_t p{u};
+
+    std::vector<std::size_t> selected;
+    p.set_telemetry_callback([&selected](const oneapi::dpl::experimental::telemetry_event_t& e) {
+        if (e.kind == oneapi::dpl::experimental::telemetry_event_kind_t::selection)
+            selected.push_back(e.resource_index);
+    });
+    for (int i = 0; i < 10; ++i)
+        oneapi::dpl::experimental::submit_and_wait(p, [](int e) { return e; });
+
+    auto t = p.get_telemetry();
+    bool pass = t.resources.size() == u.size() && t.keys.empty() && selected.size() == 10;
+    for (std::size_t i = 0; pass && i < u.size(); ++i)
+        pass = t.resources[i].selections == (i < 2 ? 3 : 2);
+    for (std::size_t i = 0; pass && i < selected.size(); ++i)
+        pass = selected[i] == i % u.size();
+    EXPECT_TRUE(pass, "ERROR: wrong telemetry of round_robin_policy\n");
+    return 0;
+}
+
+// The callback is replaced while other threads select, and the counters of all the threads are added up
+int
+test_concurrent_telemetry()
+{
+    using policy_t = oneapi::dpl::experimental::round_robin_policy<TestUtils::int_inline_backend_t>;
+    std::vector<int> u{4, 5, 6, 7};
+    policy_t p{u};
+
+    constexpr int n_threads = 4;
+    constexpr int n_tasks = 1000;
+    std::atomic<int> n_events{0};
+    std::atomic<bool> done{false};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < n_threads; ++t)
+    {
+        threads.emplace_back([&p]() {
+            for (int i = 0; i < n_tasks; ++i)
+                oneapi::dpl::experimental::submit_and_wait(p, [](int e) { return e; });
+        });
+    }
+    std::thread replacer([&]() {
+        for (int i = 0; !done.load(); ++i)
+        {
+            if (i % 2)
+                p.set_telemetry_callback(nullptr);
+            else
+                p.set_telemetry_callback([&n_events](const oneapi::dpl::experimental::telemetry_event_t&) {
+                    n_events.fetch_add(1, std::memory_order_relaxed);
+                });
+        }
+    });
+    for (auto& t : threads)
+        t.join();
+    done = true;
+    replacer.join();
+
+    auto t = p.get_telemetry();
+    std::uint64_t selections = 0;
+    for (const auto& r : t.resources)
+        selections += r.selections;
+    EXPECT_EQ(std::uint64_t(n_threads * n_tasks), selections, "ERROR: lost selections in the telemetry\n");
+    EXPECT_TRUE(n_events.load() <= n_threads * n_tasks, "ERROR: too many telemetry events\n");
+    return 0;
+}
+
 int
 main()
 {
@@ -33,6 +109,8 @@ main()
     actual = test_submit_and_wait<call_select_before_submit, policy_t>(u, f);
     actual = test_submit_and_wait_on_group<just_call_submit, policy_t>(u, f);
     actual = test_submit_and_wait_on_group<call_select_before_submit, policy_t>(u, f);
+    actual = test_telemetry();
+    actual = test_concurrent_telemetry();
 
     return TestUtils::done();
 }
@@ -0,0 +1,134 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "support/test_config.h"
+
+#include "oneapi/dpl/dynamic_selection"
+
+#include "support/test_dynamic_selection_utils.h"
+#include "support/inline_backend.h"
+#include "support/utils.h"
+
+#include <chrono>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+using policy_t = oneapi::dpl::experimental::split_policy<TestUtils::int_inline_backend_t>;
+
+template <typename Shares>
+bool
+check_shares(const Shares& shares, const std::vector<std::size_t>& expected)
+{
+    std::size_t offset = 0;
+    bool pass = shares.size() == expected.size();
+    for (std::size_t i = 0; pass && i < shares.size(); ++i)
+    {
+        pass = shares[i].offset() == offset && shares[i].size() == expected[i];
+        offset += shares[i].size();
+    }
+    return pass;
+}
+
+// The shares follow the reported throughputs
+int
+test_shares()
+{
+    std::vector<int> u{4, 5, 6};
+    policy_t p{u};
+
+    // nothing is measured yet
+    auto shares = p.split(90);
+    EXPECT_TRUE(check_shares(shares, {30, 30, 30}), "ERROR: wrong initial shares of split_policy\n");
+
+    // 1, 1/2 and 1/4 elements per nanosecond
+    for (std::size_t i = 0; i < shares.size(); ++i)
+        oneapi::dpl::experimental::report(shares[i], oneapi::dpl::experimental::execution_info::task_time,
+                                          std::chrono::nanoseconds(30 << i));
+    EXPECT_TRUE(check_shares(p.split(70), {40, 20, 10}), "ERROR: wrong measured shares of split_policy\n");
+    EXPECT_TRUE(oneapi::dpl::experimental::unwrap(oneapi::dpl::experimental::select(p)) == 4,
+                "ERROR: split_policy does not select the fastest resource\n");
+
+    // too few elements for all the resources
+    auto few = p.split(2);
+    std::size_t total = 0;
+    for (auto& s : few)
+        total += s.size();
+    EXPECT_TRUE(few.size() <= 2 && total == 2, "ERROR: wrong shares of a short range\n");
+    EXPECT_TRUE(p.split(0).empty(), "ERROR: shares of an empty range\n");
+
+    // a resource is never starved, so that its throughput is still measured
+    p.split(64)[2].report(oneapi::dpl::experimental::execution_info::task_time, std::chrono::nanoseconds(1000000));
+    shares = p.split(1000);
+    EXPECT_TRUE(shares.size() == 3 && shares[2].size() > 0, "ERROR: a resource of split_policy is starved\n");
+    return 0;
+}
+
+// The split algorithms give the results of the serial ones
+int
+test_algorithms()
+{
+    std::vector<int> u{4, 5, 6};
+    policy_t p{u};
+
+    const std::size_t n = 1000;
+    std::vector<int> v(n);
+    std::iota(v.begin(), v.end(), 1);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        long long sum = oneapi::dpl::experimental::split_reduce(p, v.begin(), v.end(), 10LL);
+        EXPECT_EQ(10LL + n * (n + 1) / 2, sum, "wrong result of split_reduce");
+    }
+    int max = oneapi::dpl::experimental::split_reduce(p, v.begin(), v.end(), 0,
+                                                      [](int a, int b) { return std::max(a, b); });
+    EXPECT_EQ(int(n), max, "wrong result of split_reduce with an operation");
+
+    std::vector<int> squares(n);
+    auto end = oneapi::dpl::experimental::split_transform(p, v.begin(), v.end(), squares.begin(),
+                                                          [](int x) { return x * x; });
+    bool pass = end == squares.end();
+    for (std::size_t i = 0; pass && i < n; ++i)
+        pass = squares[i] == v[i] * v[i];
+    EXPECT_TRUE(pass, "ERROR: wrong result of split_transform\n");
+
+    oneapi::dpl::experimental::split_for_each(p, squares.begin(), squares.end(), [](int& x) { x = -x; });
+    pass = true;
+    for (std::size_t i = 0; pass && i < n; ++i)
+        pass = squares[i] == -v[i] * v[i];
+    EXPECT_TRUE(pass, "ERROR: wrong result of split_for_each\n");
+
+    oneapi::dpl::experimental::split_sort(p, squares.begin(), squares.end());
+    EXPECT_TRUE(std::is_sorted(squares.begin(), squares.end()), "ERROR: wrong result of split_sort\n");
+    oneapi::dpl::experimental::split_sort(p, squares.begin(), squares.end(), std::greater<int>());
+    EXPECT_TRUE(std::is_sorted(squares.begin(), squares.end(), std::greater<int>()),
+                "ERROR: wrong result of split_sort with a comparator\n");
+    return 0;
+}
+
+int
+main()
+{
+    std::vector<int> u{4, 5, 6, 7};
+    auto f = [u](int i) { return u[0]; };
+
+    constexpr bool just_call_submit = false;
+    constexpr bool call_select_before_submit = true;
+
+    auto actual = test_initialization<policy_t, int>(u);
+    actual = test_select<policy_t, decltype(u), decltype(f)&, false>(u, f);
+    actual = test_submit_and_wait_on_event<just_call_submit, policy_t>(u, f);
+    actual = test_submit_and_wait_on_event<call_select_before_submit, policy_t>(u, f);
+    actual = test_submit_and_wait<just_call_submit, policy_t>(u, f);
+    actual = test_submit_and_wait<call_select_before_submit, policy_t>(u, f);
+    actual = test_shares();
+    actual = test_algorithms();
+
+    return TestUtils::done();
+}
@@ -59,13 +59,50 @@ test_body_reduction(Policy&& exec, Iterator first, Iterator last, Iterator /* ex
     EXPECT_TRUE(var2 == var2_exp, "wrong result of reduction 2");
 }
 
+// The vectorized loop keeps the reductions per SIMD lane while the inductions follow the ordinal position
+template <typename Policy, typename Iterator, typename Size>
+void
+test_body_reduction_induction(Policy&& exec, Iterator first, Iterator last, Size)
+{
+    using T = typename ::std::iterator_traits<Iterator>::value_type;
+
+    T sum = 1;
+    T max = T(-1000);
+    ::std::experimental::for_loop_strided(::std::forward<Policy>(exec), first, last, 2,
+                                          ::std::experimental::reduction_plus(sum),
+                                          ::std::experimental::reduction_max(max),
+                                          ::std::experimental::induction(T(5), 3),
+                                          [](Iterator iter, T& sum_acc, T& max_acc, T position) {
+                                              sum_acc += *iter + position;
+                                              max_acc = ::std::max(max_acc, *iter - position);
+                                          });
+
+    T sum_exp = 1;
+    T max_exp = T(-1000);
+    T position = 5;
+    ::std::size_t i = 0;
+    for (auto iter = first; iter != last; ++iter, ++i)
+    {
+        if (i % 2 == 0)
+        {
+            sum_exp += *iter + position;
+            max_exp = ::std::max(max_exp, *iter - position);
+            position += 3;
+        }
+    }
+
+    EXPECT_TRUE(sum == sum_exp, "wrong result of reduction with induction");
+    EXPECT_TRUE(max == max_exp, "wrong result of reduction_max with induction");
+}
+
 struct test_body
 {
     template <typename Policy, typename Iterator, typename Size>
     void
     operator()(Policy&& exec, Iterator first, Iterator last, Iterator expected_first, Iterator expected_last, Size n)
     {
-        test_body_reduction(::std::forward<Policy>(exec), first, last, expected_first, expected_last, n);
+        test_body_reduction(exec, first, last, expected_first, expected_last, n);
+        test_body_reduction_induction(::std::forward<Policy>(exec), first, last, n);
     }
 };
 
@@ -0,0 +1,134 @@
+// -*- C++ -*-
+//===-- for_loop_tiled.pass.cpp -------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "oneapi/dpl/execution"
+#include "oneapi/dpl/pstl/experimental/algorithm"
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "support/utils.h"
+
+using namespace TestUtils;
+
+// Each index of the space is visited once
+template <typename Policy, typename... Tiles>
+void
+test_2d_visits(Policy&& exec, std::ptrdiff_t rows, std::ptrdiff_t cols, Tiles... tiles)
+{
+    std::vector<int> visits(rows * cols, 0);
+    ::std::experimental::for_loop(std::forward<Policy>(exec), ::std::experimental::extents(rows, cols), tiles...,
+                                  [&visits, cols](std::ptrdiff_t i, std::ptrdiff_t j) { ++visits[i * cols + j]; });
+
+    bool visited_once = true;
+    for (int v : visits)
+        visited_once &= (v == 1);
+    EXPECT_TRUE(visited_once, "wrong coverage of the 2D iteration space");
+}
+
+// The reductions see each index once and the inductions follow the row-major position
+template <typename Policy>
+void
+test_2d_reduction_induction(Policy&& exec, std::ptrdiff_t rows, std::ptrdiff_t cols, std::ptrdiff_t tile_rows,
+                            std::ptrdiff_t tile_cols)
+{
+    long long sum = 0;
+    long long max = -1;
+    long long position_sum = 0;
+    long long last = 0;
+    ::std::experimental::for_loop(std::forward<Policy>(exec), ::std::experimental::extents(rows, cols),
+                                  ::std::experimental::tile_sizes(tile_rows, tile_cols),
+                                  ::std::experimental::reduction_plus(sum), ::std::experimental::reduction_max(max),
+                                  ::std::experimental::reduction_plus(position_sum),
+                                  ::std::experimental::induction(last, 2),
+                                  [cols](std::ptrdiff_t i, std::ptrdiff_t j, long long& sum_acc, long long& max_acc,
+                                         long long& position_acc, long long position) {
+                                      sum_acc += i * 1000 + j;
+                                      max_acc = std::max<long long>(max_acc, i - j);
+                                      position_acc += position - 2 * (i * cols + j);
+                                  });
+
+    long long sum_exp = 0;
+    long long max_exp = -1;
+    for (std::ptrdiff_t i = 0; i < rows; ++i)
+        for (std::ptrdiff_t j = 0; j < cols; ++j)
+        {
+            sum_exp += i * 1000 + j;
+            max_exp = std::max<long long>(max_exp, i - j);
+        }
+
+    EXPECT_EQ(sum_exp, sum, "wrong sum over the 2D iteration space");
+    EXPECT_EQ(max_exp, max, "wrong max over the 2D iteration space");
+    EXPECT_EQ(0, position_sum, "wrong induction positions over the 2D iteration space");
+    EXPECT_EQ(2 * rows * cols, last, "wrong final value of the induction");
+}
+
+template <typename Policy>
+void
+test_3d(Policy&& exec, int n0, int n1, int n2)
+{
+    std::vector<int> visits(n0 * n1 * n2, 0);
+    long long sum = 0;
+    ::std::experimental::for_loop(std::forward<Policy>(exec), ::std::experimental::extents(n0, n1, n2),
+                                  ::std::experimental::tile_sizes(2, 3, 5), ::std::experimental::reduction_plus(sum),
+                                  [&](int i, int j, int k, long long& acc) {
+                                      ++visits[(i * n1 + j) * n2 + k];
+                                      acc += i * 10000 + j * 100 + k;
+                                  });
+
+    long long sum_exp = 0;
+    bool visited_once = true;
+    for (int i = 0; i < n0; ++i)
+        for (int j = 0; j < n1; ++j)
+            for (int k = 0; k < n2; ++k)
+            {
+                sum_exp += i * 10000 + j * 100 + k;
+                visited_once &= (visits[(i * n1 + j) * n2 + k] == 1);
+            }
+
+    EXPECT_TRUE(visited_once, "wrong coverage of the 3D iteration space");
+    EXPECT_EQ(sum_exp, sum, "wrong sum over the 3D iteration space");
+}
+
+template <typename Policy>
+void
+test_policy(Policy&& exec)
+{
+    for (std::ptrdiff_t rows : {0, 1, 7, 64, 100})
+    {
+        for (std::ptrdiff_t cols : {0, 1, 13, 600})
+        {
+            test_2d_visits(exec, rows, cols);
+            test_2d_visits(exec, rows, cols, ::std::experimental::tile_sizes(3, 8));
+            test_2d_reduction_induction(exec, rows, cols, 16, 32);
+            test_2d_reduction_induction(exec, rows, cols, 5, 1000);
+        }
+    }
+    test_3d(exec, 1, 1, 1);
+    test_3d(exec, 7, 11, 13);
+    test_3d(exec, 20, 30, 40);
+}
+
+int
+main()
+{
+    test_policy(oneapi::dpl::execution::seq);
+    test_policy(oneapi::dpl::execution::unseq);
+    test_policy(oneapi::dpl::execution::par);
+    test_policy(oneapi::dpl::execution::par_unseq);
+
+    // serial version
+    long long sum = 0;
+    ::std::experimental::for_loop(::std::experimental::extents(30, 40), ::std::experimental::reduction_plus(sum),
+                                  [](int i, int j, long long& acc) { acc += i + j; });
+    EXPECT_EQ(30 * 40 * (29 + 39) / 2, sum, "wrong sum of the serial version");
+
+    return done();
+}
@@ -0,0 +1,109 @@
+// -*- C++ -*-
+//===-- zip_iterator_pointers.pass.cpp ------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// Tests for the algorithms over zip_iterator of pointers (a structure of arrays), which the vectorized versions
+// index through each of the pointers
+#include "support/test_config.h"
+
+#include _PSTL_TEST_HEADER(execution)
+#include _PSTL_TEST_HEADER(algorithm)
+#include _PSTL_TEST_HEADER(numeric)
+#include _PSTL_TEST_HEADER(iterator)
+
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+#include "support/utils.h"
+
+using namespace TestUtils;
+
+template <typename Policy>
+void
+test_structure_of_arrays(Policy&& exec, std::size_t n)
+{
+    std::vector<float> x(n), y(n), z(n, -1.0f);
+    std::vector<std::int32_t> ids(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        x[i] = float(i % 97);
+        y[i] = float(i % 13) - 6.0f;
+        ids[i] = std::int32_t(i);
+    }
+
+    auto first = oneapi::dpl::make_zip_iterator(x.data(), y.data(), z.data());
+    auto last = first + n;
+
+    std::for_each(exec, first, last, [](auto t) { std::get<2>(t) = std::get<0>(t) * std::get<1>(t); });
+    bool ok = true;
+    for (std::size_t i = 0; i < n; ++i)
+        ok &= z[i] == x[i] * y[i];
+    EXPECT_TRUE(ok, "wrong effect from for_each over zip_iterator of pointers");
+
+    std::vector<float> sums(n);
+    auto end = std::transform(exec, first, last, sums.data(),
+                              [](const auto& t) { return std::get<0>(t) + std::get<1>(t); });
+    EXPECT_TRUE(end == sums.data() + n, "wrong result from transform over zip_iterator of pointers");
+    ok = true;
+    for (std::size_t i = 0; i < n; ++i)
+        ok &= sums[i] == x[i] + y[i];
+    EXPECT_TRUE(ok, "wrong effect from transform over zip_iterator of pointers");
+
+    // the output is a zip_iterator of pointers as well
+    auto out_first = oneapi::dpl::make_zip_iterator(z.data(), ids.data());
+    std::transform(exec, x.data(), x.data() + n, out_first,
+                   [](float v) { return std::make_tuple(v + 1.0f, std::int32_t(v)); });
+    ok = true;
+    for (std::size_t i = 0; i < n; ++i)
+        ok &= z[i] == x[i] + 1.0f && ids[i] == std::int32_t(x[i]);
+    EXPECT_TRUE(ok, "wrong effect from transform to zip_iterator of pointers");
+
+    double expected_dot = 0;
+    for (std::size_t i = 0; i < n; ++i)
+        expected_dot += double(x[i]) * double(y[i]);
+    double dot = std::transform_reduce(exec, first, last, 0.0, std::plus<double>(),
+                                       [](auto t) { return double(std::get<0>(t)) * double(std::get<1>(t)); });
+    EXPECT_EQ(expected_dot, dot, "wrong result from transform_reduce over zip_iterator of pointers");
+
+    auto expected_count = std::count_if(x.begin(), x.end(), [](float v) { return v < 20.0f; });
+    auto count = std::count_if(exec, first, last, [](const auto& t) { return std::get<0>(t) < 20.0f; });
+    EXPECT_EQ(expected_count, count, "wrong result from count_if over zip_iterator of pointers");
+
+    auto pair_first = oneapi::dpl::make_zip_iterator(y.data(), ids.data());
+    std::fill(exec, pair_first, pair_first + n, std::make_tuple(2.5f, std::int32_t(7)));
+    ok = true;
+    for (std::size_t i = 0; i < n; ++i)
+        ok &= y[i] == 2.5f && ids[i] == 7;
+    EXPECT_TRUE(ok, "wrong effect from fill over zip_iterator of pointers");
+
+    std::generate(exec, pair_first, pair_first + n, []() { return std::make_tuple(-1.0f, std::int32_t(3)); });
+    ok = true;
+    for (std::size_t i = 0; i < n; ++i)
+        ok &= y[i] == -1.0f && ids[i] == 3;
+    EXPECT_TRUE(ok, "wrong effect from generate over zip_iterator of pointers");
+}
+
+template <typename Policy>
+void
+test_policy(Policy&& exec)
+{
+    for (std::size_t n : {0, 1, 7, 64, 1000, 100003})
+        test_structure_of_arrays(exec, n);
+}
+
+int
+main()
+{
+    test_policy(oneapi::dpl::execution::seq);
+    test_policy(oneapi::dpl::execution::unseq);
+    test_policy(oneapi::dpl::execution::par);
+    test_policy(oneapi::dpl::execution::par_unseq);
+
+    return done();
+}
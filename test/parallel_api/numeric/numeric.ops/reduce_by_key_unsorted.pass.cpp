@@ -0,0 +1,200 @@
+// -*- C++ -*-
+//===-- reduce_by_key_unsorted.pass.cpp -----------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "support/test_config.h"
+
+#include <oneapi/dpl/execution>
+#include <oneapi/dpl/algorithm>
+
+#include "support/utils.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if TEST_DPCPP_BACKEND_PRESENT
+#    include "support/utils_sycl.h"
+#endif
+
+using namespace TestUtils;
+
+// The keys of the given number of the distinct values, spread over the sequence
+std::vector<std::int32_t>
+make_keys(std::size_t n, std::size_t cardinality)
+{
+    std::vector<std::int32_t> keys(n);
+    for (std::size_t i = 0; i < n; ++i)
+        keys[i] = std::int32_t((i * 7919 + 13) % cardinality) - 100;
+    return keys;
+}
+
+// The distinct keys and the reductions of their values
+template <typename Key, typename T, typename BinaryOperator>
+std::pair<std::vector<Key>, std::vector<T>>
+reduce_unsorted(const std::vector<Key>& keys, const std::vector<T>& values, BinaryOperator op)
+{
+    std::vector<Key> out_keys;
+    std::vector<T> out_values;
+    std::unordered_map<Key, std::size_t> index;
+    for (std::size_t i = 0; i < keys.size(); ++i)
+    {
+        auto [it, inserted] = index.emplace(keys[i], out_keys.size());
+        if (inserted)
+        {
+            out_keys.push_back(keys[i]);
+            out_values.push_back(values[i]);
+        }
+        else
+            out_values[it->second] = op(out_values[it->second], values[i]);
+    }
+    return {out_keys, out_values};
+}
+
+// The pairs of the keys and the values in the order of the keys, since the order of the output is unspecified
+template <typename KeyIterator, typename ValueIterator>
+std::vector<std::pair<typename std::iterator_traits<KeyIterator>::value_type,
+                      typename std::iterator_traits<ValueIterator>::value_type>>
+sorted_pairs(KeyIterator keys, ValueIterator values, std::size_t m)
+{
+    std::vector<std::pair<typename std::iterator_traits<KeyIterator>::value_type,
+                          typename std::iterator_traits<ValueIterator>::value_type>>
+        pairs;
+    for (std::size_t i = 0; i < m; ++i, ++keys, ++values)
+        pairs.emplace_back(*keys, *values);
+    std::sort(pairs.begin(), pairs.end());
+    return pairs;
+}
+
+template <typename T, typename Policy>
+void
+test_keys(Policy&& exec, std::size_t n, std::size_t cardinality)
+{
+    const std::vector<std::int32_t> keys = make_keys(n, cardinality);
+    std::vector<T> values(n);
+    for (std::size_t i = 0; i < n; ++i)
+        values[i] = T(i % 5);
+
+    std::vector<std::int32_t> out_keys(n + 1, -1);
+    std::vector<T> out_values(n + 1, T(-1));
+    auto expected = reduce_unsorted(keys, values, std::plus<T>());
+    const std::size_t m = expected.first.size();
+
+    auto res = oneapi::dpl::reduce_by_key_unsorted(exec, keys.begin(), keys.end(), values.begin(), out_keys.begin(),
+                                                   out_values.begin());
+    EXPECT_TRUE(res.first == out_keys.begin() + m && res.second == out_values.begin() + m,
+                "wrong result from reduce_by_key_unsorted");
+    EXPECT_TRUE(sorted_pairs(out_keys.begin(), out_values.begin(), m) ==
+                    sorted_pairs(expected.first.begin(), expected.second.begin(), m),
+                "wrong effect from reduce_by_key_unsorted");
+    EXPECT_TRUE(out_keys[m] == -1 && out_values[m] == T(-1), "reduce_by_key_unsorted wrote past the end");
+
+    // with a predicate, an operation and the expected number of the distinct keys, which may exceed the size
+    auto max_op = [](T a, T b) { return std::max(a, b); };
+    expected = reduce_unsorted(keys, values, max_op);
+    auto res_hint = oneapi::dpl::reduce_by_key_unsorted(exec, keys.data(), keys.data() + n, values.data(),
+                                                        out_keys.data(), out_values.data(),
+                                                        std::equal_to<std::int32_t>(), max_op, cardinality);
+    EXPECT_TRUE(res_hint.first == out_keys.data() + m && res_hint.second == out_values.data() + m,
+                "wrong result from reduce_by_key_unsorted with a size hint");
+    EXPECT_TRUE(sorted_pairs(out_keys.begin(), out_values.begin(), m) ==
+                    sorted_pairs(expected.first.begin(), expected.second.begin(), m),
+                "wrong effect from reduce_by_key_unsorted with a maximum");
+}
+
+template <typename Policy>
+void
+test_strings(Policy&& exec)
+{
+    const std::vector<std::string> words = {"b", "a", "c", "b", "b", "a", "d", "c"};
+    const std::vector<std::size_t> counts(words.size(), 1);
+    std::list<std::string> out_words(words.size());
+    std::list<std::size_t> out_counts(words.size());
+
+    auto res = oneapi::dpl::reduce_by_key_unsorted(exec, words.begin(), words.end(), counts.begin(),
+                                                   out_words.begin(), out_counts.begin());
+    const std::vector<std::pair<std::string, std::size_t>> expected = {{"a", 2}, {"b", 3}, {"c", 2}, {"d", 1}};
+    EXPECT_TRUE(std::distance(out_words.begin(), res.first) == 4 && std::distance(out_counts.begin(), res.second) == 4,
+                "wrong result from reduce_by_key_unsorted of strings");
+    EXPECT_TRUE(sorted_pairs(out_words.begin(), out_counts.begin(), 4) == expected,
+                "wrong effect from reduce_by_key_unsorted of strings");
+}
+
+template <typename T, typename Policy>
+void
+test_policy(Policy&& exec)
+{
+    for (std::size_t n : {0, 1, 1000, 100003})
+    {
+        for (std::size_t cardinality : {1, 7, 1000, 100003})
+            test_keys<T>(exec, n, cardinality);
+    }
+    test_strings(exec);
+}
+
+#if TEST_DPCPP_BACKEND_PRESENT
+// Device policies with USM shared memory
+void
+test_device()
+{
+    sycl::queue q = TestUtils::get_test_queue();
+
+    const std::size_t n = 100003;
+    const std::vector<std::int32_t> host_keys = make_keys(n, 1000);
+    auto expected = reduce_unsorted(host_keys, std::vector<std::int64_t>(n, 1), std::plus<std::int64_t>());
+    const std::size_t m = expected.first.size();
+
+    std::int32_t* keys = sycl::malloc_shared<std::int32_t>(n, q);
+    std::int64_t* values = sycl::malloc_shared<std::int64_t>(n, q);
+    std::int32_t* out_keys = sycl::malloc_shared<std::int32_t>(n, q);
+    std::int64_t* out_values = sycl::malloc_shared<std::int64_t>(n, q);
+    std::copy(host_keys.begin(), host_keys.end(), keys);
+    std::fill(values, values + n, 1);
+
+    auto policy = TestUtils::make_device_policy<class ReduceByKeyUnsortedDevice>(q);
+    auto res = oneapi::dpl::reduce_by_key_unsorted(policy, keys, keys + n, values, out_keys, out_values);
+    EXPECT_TRUE(res.first == out_keys + m, "wrong result from reduce_by_key_unsorted with a device policy");
+    EXPECT_TRUE(sorted_pairs(out_keys, out_values, m) ==
+                    sorted_pairs(expected.first.begin(), expected.second.begin(), m),
+                "wrong effect from reduce_by_key_unsorted with a device policy");
+
+    sycl::free(out_values, q);
+    sycl::free(out_keys, q);
+    sycl::free(values, q);
+    sycl::free(keys, q);
+}
+#endif // TEST_DPCPP_BACKEND_PRESENT
+
+template <typename T>
+void
+test_by_type()
+{
+    test_policy<T>(oneapi::dpl::execution::seq);
+    test_policy<T>(oneapi::dpl::execution::unseq);
+    test_policy<T>(oneapi::dpl::execution::par);
+    test_policy<T>(oneapi::dpl::execution::par_unseq);
+}
+
+int
+main()
+{
+    test_by_type<std::int64_t>();
+    test_by_type<float64_t>();
+
+#if TEST_DPCPP_BACKEND_PRESENT
+    test_device();
+#endif
+
+    return done();
+}
@@ -0,0 +1,100 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "support/test_config.h"
+
+#include <oneapi/dpl/execution>
+#include <oneapi/dpl/algorithm>
+#include <oneapi/dpl/numeric>
+
+#if _ENABLE_RANGES_TESTING
+#include <oneapi/dpl/ranges>
+#endif
+
+#include "support/utils.h"
+
+#include <vector>
+
+#if _ENABLE_RANGES_TESTING
+template <typename Policy>
+void
+test_stride(Policy&& exec, int n, int stride)
+{
+    using namespace oneapi::dpl::experimental::ranges;
+
+    std::vector<int> data(n);
+    std::iota(data.begin(), data.end(), 0);
+
+    //the name nano::ranges::views::all is not injected into oneapi::dpl::experimental::ranges namespace
+    auto view1 = __nanorange::nano::ranges::views::all(data) | views::stride(stride);
+    auto view2 = views::stride(__nanorange::nano::ranges::views::all(data), stride);
+
+    std::vector<int> expected;
+    for (int i = 0; i < n; i += stride)
+        expected.push_back(i);
+
+    EXPECT_EQ(expected.size(), std::size_t(view1.size()), "wrong size of stride view, a pipe call");
+    EXPECT_EQ_N(expected.begin(), view1.begin(), expected.size(), "wrong result from stride view, a pipe call");
+    EXPECT_EQ_N(expected.begin(), view2.begin(), expected.size(), "wrong result from stride view, a single CPO call");
+
+    auto sum = std::reduce(exec, view1.begin(), view1.end(), 0);
+    EXPECT_EQ(std::reduce(expected.begin(), expected.end(), 0), sum, "wrong reduce over stride view");
+
+    //a column of a row-major matrix with stride columns
+    std::transform(exec, view1.begin(), view1.end(), view1.begin(), [](int x) { return -x; });
+    std::vector<int> transformed(n);
+    for (int i = 0; i < n; ++i)
+        transformed[i] = i % stride == 0 ? -i : i;
+    EXPECT_EQ_N(transformed.begin(), data.begin(), n, "wrong transform over stride view");
+}
+
+template <typename Policy>
+void
+test_chunk(Policy&& exec, int n, int chunk)
+{
+    using namespace oneapi::dpl::experimental::ranges;
+
+    std::vector<int> data(n, 1);
+    auto view = __nanorange::nano::ranges::views::all(data) | views::chunk(chunk);
+
+    EXPECT_EQ((n + chunk - 1) / chunk, int(view.size()), "wrong size of chunk view");
+
+    //one call of the functor per chunk: the first element of a chunk gets the size of the chunk
+    std::for_each(exec, view.begin(), view.end(), [](auto batch) {
+        *batch.begin() = int(batch.size());
+        for (auto it = batch.begin() + 1; it != batch.end(); ++it)
+            *it = 0;
+    });
+    bool ok = true;
+    for (int i = 0; i < n; ++i)
+        ok &= data[i] == (i % chunk != 0 ? 0 : (i + chunk <= n ? chunk : n - i));
+    EXPECT_TRUE(ok, "wrong for_each over chunk view");
+}
+#endif //_ENABLE_RANGES_TESTING
+
+std::int32_t
+main()
+{
+#if _ENABLE_RANGES_TESTING
+    for (int n : {0, 1, 10, 1000, 100003})
+    {
+        for (int k : {1, 3, 64})
+        {
+            test_stride(oneapi::dpl::execution::seq, n, k);
+            test_stride(oneapi::dpl::execution::unseq, n, k);
+            test_stride(oneapi::dpl::execution::par, n, k);
+            test_stride(oneapi::dpl::execution::par_unseq, n, k);
+
+            test_chunk(oneapi::dpl::execution::seq, n, k);
+            test_chunk(oneapi::dpl::execution::par, n, k);
+        }
+    }
+#endif //_ENABLE_RANGES_TESTING
+    return TestUtils::done(_ENABLE_RANGES_TESTING);
+}
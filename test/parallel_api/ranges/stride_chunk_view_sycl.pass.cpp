@@ -0,0 +1,58 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "support/test_config.h"
+
+#include <oneapi/dpl/execution>
+#include <oneapi/dpl/algorithm>
+
+#if _ENABLE_RANGES_TESTING
+#include <oneapi/dpl/ranges>
+#endif
+
+#include "support/utils.h"
+
+#include <iostream>
+
+std::int32_t
+main()
+{
+#if _ENABLE_RANGES_TESTING
+    constexpr int max_n = 10;
+    constexpr int stride = 3;
+    int data[max_n]     = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    int expected[max_n] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+    int batches[max_n]  = {1, 1, 1, 1, 1, 1, 1, 1, 1, 1};
+
+    using namespace oneapi::dpl::experimental;
+    {
+        sycl::buffer<int> A(data, sycl::range<1>(max_n));
+        sycl::buffer<int> B(expected, sycl::range<1>(max_n));
+        sycl::buffer<int> C(batches, sycl::range<1>(max_n));
+        ranges::copy(TestUtils::default_dpcpp_policy, ranges::views::all_read(A) | ranges::views::stride(stride),
+                     ranges::views::all_write(B));
+        //one call of the functor per chunk: the first element of a chunk gets the size of the chunk
+        ranges::for_each(TestUtils::default_dpcpp_policy, ranges::views::all(C) | ranges::views::chunk(stride),
+                         [](auto batch) {
+                             *batch.begin() = int(batch.size());
+                             for (auto it = batch.begin() + 1; it != batch.end(); ++it)
+                                 *it = 0;
+                         });
+    }
+
+    //check result
+    int expected_strided[max_n] = {0, 3, 6, 9, 0, 0, 0, 0, 0, 0};
+    int expected_batches[max_n] = {3, 0, 0, 3, 0, 0, 3, 0, 0, 1};
+
+    EXPECT_EQ_N(expected_strided, expected, max_n, "wrong result from stride view on a device");
+    EXPECT_EQ_N(expected_batches, batches, max_n, "wrong result from chunk view on a device");
+
+#endif //_ENABLE_RANGES_TESTING
+    return TestUtils::done(_ENABLE_RANGES_TESTING);
+}
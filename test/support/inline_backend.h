@@ -15,6 +15,7 @@
 #include <vector>
 #include <atomic>
 #include <chrono>
+#include <string>
 
 namespace TestUtils
 {
@@ -51,7 +52,7 @@ class int_inline_backend_t
     using wait_type = int;
     using execution_resource_t = basic_execution_resource_t<resource_type>;
     using resource_container_t = std::vector<execution_resource_t>;
-    using report_duration = std::chrono::milliseconds;
+    using report_duration = std::chrono::nanoseconds;
 
   private:
     using native_resource_container_t = std::vector<resource_type>;
@@ -139,6 +140,12 @@ class int_inline_backend_t
         return resources_;
     }
 
+    std::string
+    get_resource_descriptor(const execution_resource_t& r) const
+    {
+        return std::to_string(r.unwrap());
+    }
+
   private:
     resource_container_t resources_;
 };
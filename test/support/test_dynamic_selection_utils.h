@@ -164,13 +164,14 @@ test_submit_and_wait_on_group(UniverseContainer u, ResourceFunction&& f, int off
 
     int N = 100;
     std::atomic<int> ecount = 0;
-    bool pass = true;
+    // the tasks may run concurrently and after the iteration that submitted them
+    std::atomic<bool> pass = true;
     if constexpr (call_select_before_submit)
     {
         for (int i = 1; i <= N; i++)
         {
             auto test_resource = f(i);
-            auto func = [&](typename Policy::resource_type e) {
+            auto func = [&pass, &ecount, test_resource, i](typename Policy::resource_type e) {
                 if (e != test_resource)
                 {
                     pass = false;
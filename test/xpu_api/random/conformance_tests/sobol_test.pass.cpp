@@ -0,0 +1,101 @@
+// -*- C++ -*-
+//===-- sobol_test.pass.cpp -----------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// Abstract:
+//
+// Test for Sobol quasi-random number generation engine - comparison of 10 000th element
+// and stratification of the points generated independently in each work item
+
+#include "support/utils.h"
+
+#if TEST_UNNAMED_LAMBDAS
+#include "common_for_conformance_tests.hpp"
+#include <oneapi/dpl/random>
+#endif // TEST_UNNAMED_LAMBDAS
+
+namespace ex = oneapi::dpl::experimental;
+
+#if TEST_UNNAMED_LAMBDAS
+
+// Each of the first 2^M points must fall into its own interval [k / 2^M, (k + 1) / 2^M) in every dimension
+template <std::size_t Dims, int M>
+int
+test_stratification(sycl::queue& queue, std::uint32_t seed)
+{
+    constexpr std::size_t n_points = std::size_t(1) << M;
+    std::vector<std::uint32_t> samples(n_points * Dims);
+    {
+        sycl::buffer<std::uint32_t, 1> buffer(samples.data(), samples.size());
+
+        queue.submit([&](sycl::handler& cgh) {
+            auto acc = buffer.template get_access<sycl::access::mode::write>(cgh);
+
+            cgh.parallel_for<>(sycl::range<1>(n_points), [=](sycl::item<1> idx) {
+                ex::sobol32<Dims> engine(seed);
+                engine.discard(idx.get_linear_id() * Dims);
+                for (std::size_t d = 0; d < Dims; ++d)
+                    acc[idx.get_linear_id() * Dims + d] = engine();
+            });
+        });
+    }
+
+    int err = 0;
+    for (std::size_t d = 0; d < Dims; ++d)
+    {
+        std::vector<bool> hit(n_points, false);
+        for (std::size_t i = 0; i < n_points; ++i)
+            hit[samples[i * Dims + d] >> (32 - M)] = true;
+        for (std::size_t k = 0; k < n_points; ++k)
+            err += !hit[k];
+    }
+    if (err)
+        std::cout << "Error: " << err << " empty intervals for " << Dims << " dimensions" << std::endl;
+    return err;
+}
+
+#endif // TEST_UNNAMED_LAMBDAS
+
+int
+main()
+{
+
+#if TEST_UNNAMED_LAMBDAS
+
+    sycl::queue queue = TestUtils::get_test_queue();
+
+    // Reference values
+    std::uint32_t sobol1_ref = 288096256;
+    std::uint32_t sobol4_ref = 3551526912;
+    std::uint32_t sobol21_ref = 2491416576;
+    int err = 0;
+
+    // Generate 10 000th element
+    err += test<ex::sobol32<1>, 10000, 1>(queue) != sobol1_ref;
+    err += test<ex::sobol32<4>, 10000, 1>(queue) != sobol4_ref;
+    err += test<ex::sobol32<21>, 10000, 1>(queue) != sobol21_ref;
+#if TEST_LONG_RUN
+    err += test<ex::sobol32_vec<4, 1>, 10000, 1>(queue) != sobol4_ref;
+    err += test<ex::sobol32_vec<4, 2>, 10000, 2>(queue) != sobol4_ref;
+    // In case of sobol32_vec<4, 3> engine generate 10002 values as 10000 % 3 != 0
+    err += test<ex::sobol32_vec<4, 3>, 10002, 3>(queue) != sobol4_ref;
+    err += test<ex::sobol32_vec<4, 4>, 10000, 4>(queue) != sobol4_ref;
+    err += test<ex::sobol32_vec<4, 8>, 10000, 8>(queue) != sobol4_ref;
+    err += test<ex::sobol32_vec<4, 16>, 10000, 16>(queue) != sobol4_ref;
+#endif // TEST_LONG_RUN
+    EXPECT_TRUE(!err, "Test FAILED");
+
+    err += test_stratification<2, 10>(queue, 0);
+    err += test_stratification<5, 10>(queue, 777);
+    err += test_stratification<21, 12>(queue, 777);
+    EXPECT_TRUE(!err, "Test FAILED");
+
+#endif // TEST_UNNAMED_LAMBDAS
+
+    return TestUtils::done(TEST_UNNAMED_LAMBDAS);
+}
@@ -0,0 +1,170 @@
+// -*- C++ -*-
+//===-- generate_range.pass.cpp -------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// Abstract:
+//
+// Testing of engines' and distributions' generate(first, last) methods:
+// the range must be filled with the same values as consecutive operator () calls
+
+#include "support/utils.h"
+
+#if TEST_UNNAMED_LAMBDAS
+#    include <oneapi/dpl/random>
+
+#    include <iostream>
+#    include <vector>
+
+namespace ex = oneapi::dpl::experimental;
+
+constexpr auto SEED = 777;
+constexpr auto N_GEN = 96;
+constexpr auto RANGE_SIZE = 19; // not a multiple of the Philox block size nor of the vector sizes
+
+template <class T>
+bool
+is_equal(const T& x, const T& y)
+{
+    constexpr int num_elems = oneapi::dpl::internal::type_traits_t<T>::num_elems;
+    if constexpr (num_elems == 0)
+    {
+        return x == y;
+    }
+    else
+    {
+        for (int i = 0; i < num_elems; ++i)
+            if (x[i] != y[i])
+                return false;
+        return true;
+    }
+}
+
+// Generates a range at different offsets of the sequence in each work item and compares it
+// with the values of consecutive operator () calls; the state after the range is checked as well
+template <class Engine>
+std::int32_t
+test_engine(sycl::queue& queue)
+{
+    std::vector<std::int32_t> res(N_GEN);
+    {
+        sycl::buffer<std::int32_t> buffer(res.data(), res.size());
+
+        queue.submit([&](sycl::handler& cgh) {
+            auto acc = buffer.template get_access<sycl::access::mode::write>(cgh);
+
+            cgh.parallel_for<>(sycl::range<1>(N_GEN), [=](sycl::item<1> idx) {
+                unsigned long long offset = idx.get_linear_id();
+                Engine engine0(SEED);
+                Engine engine1(SEED);
+                engine0.discard(offset);
+                engine1.discard(offset);
+
+                typename Engine::result_type range[RANGE_SIZE];
+                engine0.generate(range, range + RANGE_SIZE);
+
+                std::int32_t is_inequal = 0;
+                for (int i = 0; i < RANGE_SIZE; ++i)
+                    is_inequal |= !is_equal(range[i], engine1());
+                is_inequal |= !is_equal(engine0(), engine1());
+                acc[offset] = is_inequal;
+            });
+        });
+    }
+
+    std::int32_t sum = 0;
+    for (int i = 0; i < N_GEN; ++i)
+        sum += res[i];
+    if (sum)
+        std::cout << "Error occurred in " << sum << " elements" << std::endl;
+    return sum;
+}
+
+template <class Distr, class Engine>
+std::int32_t
+test_distr(sycl::queue& queue, Distr distr)
+{
+    std::vector<std::int32_t> res(N_GEN);
+    {
+        sycl::buffer<std::int32_t> buffer(res.data(), res.size());
+
+        queue.submit([&](sycl::handler& cgh) {
+            auto acc = buffer.template get_access<sycl::access::mode::write>(cgh);
+
+            cgh.parallel_for<>(sycl::range<1>(N_GEN), [=](sycl::item<1> idx) {
+                unsigned long long offset = idx.get_linear_id();
+                Engine engine0(SEED);
+                Engine engine1(SEED);
+                engine0.discard(offset);
+                engine1.discard(offset);
+                Distr distr0 = distr;
+                Distr distr1 = distr;
+
+                // odd number of values before the range for the Box-Muller pairs in normal_distribution
+                if (offset % 2)
+                {
+                    distr0(engine0);
+                    distr1(engine1);
+                }
+
+                typename Distr::result_type range[RANGE_SIZE];
+                distr0.generate(engine0, range, range + RANGE_SIZE);
+
+                std::int32_t is_inequal = 0;
+                for (int i = 0; i < RANGE_SIZE; ++i)
+                    is_inequal |= !is_equal(range[i], distr1(engine1));
+                is_inequal |= !is_equal(distr0(engine0), distr1(engine1));
+                acc[offset] = is_inequal;
+            });
+        });
+    }
+
+    std::int32_t sum = 0;
+    for (int i = 0; i < N_GEN; ++i)
+        sum += res[i];
+    if (sum)
+        std::cout << "Error occurred in " << sum << " elements" << std::endl;
+    return sum;
+}
+
+#endif // TEST_UNNAMED_LAMBDAS
+
+int
+main()
+{
+
+#if TEST_UNNAMED_LAMBDAS
+
+    sycl::queue queue = TestUtils::get_test_queue();
+    std::int32_t err = 0;
+
+    std::cout << "generate for engines" << std::endl;
+    err += test_engine<oneapi::dpl::minstd_rand>(queue);
+    err += test_engine<oneapi::dpl::minstd_rand_vec<4>>(queue);
+    err += test_engine<oneapi::dpl::ranlux24_base>(queue);
+    err += test_engine<oneapi::dpl::ranlux24>(queue);
+    err += test_engine<ex::philox4x32>(queue);
+    err += test_engine<ex::philox4x32_vec<3>>(queue);
+    EXPECT_TRUE(!err, "Test FAILED");
+
+    std::cout << "generate for distributions" << std::endl;
+    err += test_distr<oneapi::dpl::uniform_real_distribution<float>, ex::philox4x32>(
+        queue, oneapi::dpl::uniform_real_distribution<float>(-1.0f, 1.0f));
+    err += test_distr<oneapi::dpl::uniform_int_distribution<std::int32_t>, oneapi::dpl::minstd_rand>(
+        queue, oneapi::dpl::uniform_int_distribution<std::int32_t>(-10, 1000));
+    err += test_distr<oneapi::dpl::normal_distribution<float>, ex::philox4x32>(
+        queue, oneapi::dpl::normal_distribution<float>(1.0f, 2.0f));
+    err += test_distr<oneapi::dpl::normal_distribution<sycl::vec<float, 3>>, oneapi::dpl::minstd_rand>(
+        queue, oneapi::dpl::normal_distribution<sycl::vec<float, 3>>());
+    err += test_distr<oneapi::dpl::exponential_distribution<float>, oneapi::dpl::minstd_rand>(
+        queue, oneapi::dpl::exponential_distribution<float>(1.5f));
+    EXPECT_TRUE(!err, "Test FAILED");
+
+#endif // TEST_UNNAMED_LAMBDAS
+
+    return TestUtils::done(TEST_UNNAMED_LAMBDAS);
+}
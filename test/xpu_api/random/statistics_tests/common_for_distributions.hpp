@@ -115,6 +115,69 @@ statistics_check(int nsamples, const std::vector<ScalarRealType>& samples, Scala
     return compare_moments(nsamples, samples, tM, tD, tQ);
 }
 
+template <typename ScalarRealType, typename Distr>
+std::enable_if_t<std::is_same_v<Distr, oneapi::dpl::gamma_distribution<typename Distr::result_type>>, int>
+statistics_check(int nsamples, const std::vector<ScalarRealType>& samples, ScalarRealType alpha, ScalarRealType beta)
+{
+    // theoretical moments
+    double tM = alpha * beta;
+    double tD = alpha * beta * beta;
+    double tQ = 3.0 * alpha * (alpha + 2.0) * beta * beta * beta * beta;
+
+    return compare_moments(nsamples, samples, tM, tD, tQ);
+}
+
+template <typename ScalarRealType, typename Distr>
+std::enable_if_t<std::is_same_v<Distr, oneapi::dpl::chi_squared_distribution<typename Distr::result_type>>, int>
+statistics_check(int nsamples, const std::vector<ScalarRealType>& samples, ScalarRealType n)
+{
+    // theoretical moments
+    double tM = n;
+    double tD = 2.0 * n;
+    double tQ = 12.0 * n * (n + 4.0);
+
+    return compare_moments(nsamples, samples, tM, tD, tQ);
+}
+
+template <typename ScalarRealType, typename Distr>
+std::enable_if_t<std::is_same_v<Distr, oneapi::dpl::beta_distribution<typename Distr::result_type>>, int>
+statistics_check(int nsamples, const std::vector<ScalarRealType>& samples, ScalarRealType alpha, ScalarRealType beta)
+{
+    // theoretical moments
+    double s = alpha + beta;
+    double tM = alpha / s;
+    double tD = alpha * beta / (s * s * (s + 1.0));
+    double kurtosis = 6.0 * ((alpha - beta) * (alpha - beta) * (s + 1.0) - alpha * beta * (s + 2.0)) /
+                      (alpha * beta * (s + 2.0) * (s + 3.0));
+    double tQ = (kurtosis + 3.0) * tD * tD;
+
+    return compare_moments(nsamples, samples, tM, tD, tQ);
+}
+
+template <typename ScalarIntType, typename Distr>
+std::enable_if_t<std::is_same_v<Distr, oneapi::dpl::poisson_distribution<typename Distr::result_type>>, int>
+statistics_check(int nsamples, const std::vector<ScalarIntType>& samples, double mean)
+{
+    // theoretical moments
+    double tM = mean;
+    double tD = mean;
+    double tQ = mean * (1.0 + 3.0 * mean);
+
+    return compare_moments(nsamples, samples, tM, tD, tQ);
+}
+
+template <typename ScalarIntType, typename Distr>
+std::enable_if_t<std::is_same_v<Distr, oneapi::dpl::binomial_distribution<typename Distr::result_type>>, int>
+statistics_check(int nsamples, const std::vector<ScalarIntType>& samples, ScalarIntType t, double p)
+{
+    // theoretical moments
+    double tM = t * p;
+    double tD = t * p * (1.0 - p);
+    double tQ = tD * (1.0 + 3.0 * (t - 2.0) * p * (1.0 - p));
+
+    return compare_moments(nsamples, samples, tM, tD, tQ);
+}
+
 template <class Distr, class UIntType, class Engine = oneapi::dpl::linear_congruential_engine<UIntType, a, c, m>, class... Args>
 int
 test(sycl::queue& queue, int nsamples, Args... params)
@@ -366,6 +429,119 @@ tests_set(sycl::queue& queue, int nsamples)
     return 0;
 }
 
+template <class Distr, class UIntType>
+std::enable_if_t<std::is_same_v<Distr, oneapi::dpl::gamma_distribution<typename Distr::result_type>>, int>
+tests_set(sycl::queue& queue, int nsamples)
+{
+    using result_type = typename Distr::result_type;
+
+    constexpr int nparams = 2;
+
+    oneapi::dpl::internal::element_type_t<result_type> alpha_array[nparams] = {0.5, 4.0};
+    oneapi::dpl::internal::element_type_t<result_type> beta_array[nparams] = {1.0, 2.0};
+
+    // Test for all non-zero parameters
+    for (int i = 0; i < nparams; ++i)
+    {
+        std::cout << "gamma_distribution test<type>, alpha = " << alpha_array[i] << ", beta = " << beta_array[i] << ", nsamples = " << nsamples;
+        if (test<Distr, UIntType>(queue, nsamples, alpha_array[i], beta_array[i]))
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+template <class Distr, class UIntType>
+std::enable_if_t<std::is_same_v<Distr, oneapi::dpl::chi_squared_distribution<typename Distr::result_type>>, int>
+tests_set(sycl::queue& queue, int nsamples)
+{
+    using result_type = typename Distr::result_type;
+
+    constexpr int nparams = 2;
+
+    oneapi::dpl::internal::element_type_t<result_type> n_array[nparams] = {1.0, 10.0};
+
+    // Test for all non-zero parameters
+    for (int i = 0; i < nparams; ++i)
+    {
+        std::cout << "chi_squared_distribution test<type>, n = " << n_array[i] << ", nsamples = " << nsamples;
+        if (test<Distr, UIntType>(queue, nsamples, n_array[i]))
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+template <class Distr, class UIntType>
+std::enable_if_t<std::is_same_v<Distr, oneapi::dpl::beta_distribution<typename Distr::result_type>>, int>
+tests_set(sycl::queue& queue, int nsamples)
+{
+    using result_type = typename Distr::result_type;
+
+    constexpr int nparams = 2;
+
+    oneapi::dpl::internal::element_type_t<result_type> alpha_array[nparams] = {0.5, 2.0};
+    oneapi::dpl::internal::element_type_t<result_type> beta_array[nparams] = {0.5, 5.0};
+
+    // Test for all non-zero parameters
+    for (int i = 0; i < nparams; ++i)
+    {
+        std::cout << "beta_distribution test<type>, alpha = " << alpha_array[i] << ", beta = " << beta_array[i] << ", nsamples = " << nsamples;
+        if (test<Distr, UIntType>(queue, nsamples, alpha_array[i], beta_array[i]))
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+template <class Distr, class UIntType>
+std::enable_if_t<std::is_same_v<Distr, oneapi::dpl::poisson_distribution<typename Distr::result_type>>, int>
+tests_set(sycl::queue& queue, int nsamples)
+{
+    using result_type = typename Distr::result_type;
+
+    constexpr int nparams = 2;
+
+    double mean_array[nparams] = {3.5, 50.0};
+
+    // Test for all non-zero parameters
+    for (int i = 0; i < nparams; ++i)
+    {
+        std::cout << "poisson_distribution test<type>, mean = " << mean_array[i] << ", nsamples = " << nsamples;
+        if (test<Distr, UIntType>(queue, nsamples, mean_array[i]))
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+template <class Distr, class UIntType>
+std::enable_if_t<std::is_same_v<Distr, oneapi::dpl::binomial_distribution<typename Distr::result_type>>, int>
+tests_set(sycl::queue& queue, int nsamples)
+{
+    using result_type = typename Distr::result_type;
+
+    constexpr int nparams = 2;
+
+    oneapi::dpl::internal::element_type_t<result_type> t_array[nparams] = {20, 1000};
+    double p_array[nparams] = {0.3, 0.7};
+
+    // Test for all non-zero parameters
+    for (int i = 0; i < nparams; ++i)
+    {
+        std::cout << "binomial_distribution test<type>, t = " << t_array[i] << ", p = " << p_array[i] << ", nsamples = " << nsamples;
+        if (test<Distr, UIntType>(queue, nsamples, t_array[i], p_array[i]))
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
 template <class Distr, class UIntType>
 std::enable_if_t<std::is_same_v<Distr, oneapi::dpl::exponential_distribution<typename Distr::result_type>>, int>
 tests_set_portion(sycl::queue& queue, std::int32_t nsamples, unsigned int part)
@@ -522,4 +698,117 @@ tests_set_portion(sycl::queue& queue, std::int32_t nsamples, unsigned int part)
     return 0;
 }
 
+template <class Distr, class UIntType>
+std::enable_if_t<std::is_same_v<Distr, oneapi::dpl::gamma_distribution<typename Distr::result_type>>, int>
+tests_set_portion(sycl::queue& queue, std::int32_t nsamples, unsigned int part)
+{
+    using result_type = typename Distr::result_type;
+
+    constexpr int nparams = 2;
+
+    oneapi::dpl::internal::element_type_t<result_type> alpha_array[nparams] = {0.5, 4.0};
+    oneapi::dpl::internal::element_type_t<result_type> beta_array[nparams] = {1.0, 2.0};
+
+    // Test for all non-zero parameters
+    for (int i = 0; i < nparams; ++i)
+    {
+        std::cout << "gamma_distribution test<type>, alpha = " << alpha_array[i] << ", beta = " << beta_array[i] << ", nsamples = " << nsamples << ", part = " << part;
+        if (test_portion<Distr, UIntType>(queue, nsamples, part, alpha_array[i], beta_array[i]))
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+template <class Distr, class UIntType>
+std::enable_if_t<std::is_same_v<Distr, oneapi::dpl::chi_squared_distribution<typename Distr::result_type>>, int>
+tests_set_portion(sycl::queue& queue, std::int32_t nsamples, unsigned int part)
+{
+    using result_type = typename Distr::result_type;
+
+    constexpr int nparams = 2;
+
+    oneapi::dpl::internal::element_type_t<result_type> n_array[nparams] = {1.0, 10.0};
+
+    // Test for all non-zero parameters
+    for (int i = 0; i < nparams; ++i)
+    {
+        std::cout << "chi_squared_distribution test<type>, n = " << n_array[i] << ", nsamples = " << nsamples << ", part = " << part;
+        if (test_portion<Distr, UIntType>(queue, nsamples, part, n_array[i]))
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+template <class Distr, class UIntType>
+std::enable_if_t<std::is_same_v<Distr, oneapi::dpl::beta_distribution<typename Distr::result_type>>, int>
+tests_set_portion(sycl::queue& queue, std::int32_t nsamples, unsigned int part)
+{
+    using result_type = typename Distr::result_type;
+
+    constexpr int nparams = 2;
+
+    oneapi::dpl::internal::element_type_t<result_type> alpha_array[nparams] = {0.5, 2.0};
+    oneapi::dpl::internal::element_type_t<result_type> beta_array[nparams] = {0.5, 5.0};
+
+    // Test for all non-zero parameters
+    for (int i = 0; i < nparams; ++i)
+    {
+        std::cout << "beta_distribution test<type>, alpha = " << alpha_array[i] << ", beta = " << beta_array[i] << ", nsamples = " << nsamples << ", part = " << part;
+        if (test_portion<Distr, UIntType>(queue, nsamples, part, alpha_array[i], beta_array[i]))
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+template <class Distr, class UIntType>
+std::enable_if_t<std::is_same_v<Distr, oneapi::dpl::poisson_distribution<typename Distr::result_type>>, int>
+tests_set_portion(sycl::queue& queue, std::int32_t nsamples, unsigned int part)
+{
+    using result_type = typename Distr::result_type;
+
+    constexpr int nparams = 2;
+
+    double mean_array[nparams] = {3.5, 50.0};
+
+    // Test for all non-zero parameters
+    for (int i = 0; i < nparams; ++i)
+    {
+        std::cout << "poisson_distribution test<type>, mean = " << mean_array[i] << ", nsamples = " << nsamples << ", part = " << part;
+        if (test_portion<Distr, UIntType>(queue, nsamples, part, mean_array[i]))
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+template <class Distr, class UIntType>
+std::enable_if_t<std::is_same_v<Distr, oneapi::dpl::binomial_distribution<typename Distr::result_type>>, int>
+tests_set_portion(sycl::queue& queue, std::int32_t nsamples, unsigned int part)
+{
+    using result_type = typename Distr::result_type;
+
+    constexpr int nparams = 2;
+
+    oneapi::dpl::internal::element_type_t<result_type> t_array[nparams] = {20, 1000};
+    double p_array[nparams] = {0.3, 0.7};
+
+    // Test for all non-zero parameters
+    for (int i = 0; i < nparams; ++i)
+    {
+        std::cout << "binomial_distribution test<type>, t = " << t_array[i] << ", p = " << p_array[i] << ", nsamples = " << nsamples << ", part = " << part;
+        if (test_portion<Distr, UIntType>(queue, nsamples, part, t_array[i], p_array[i]))
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
 #endif // _ONEDPL_RANDOM_STATISTICS_TESTS_COMMON_FOR_DISTRS_H
@@ -129,10 +129,10 @@ int test_portion(sycl::queue& queue, oneapi::dpl::internal::element_type_t<IntTy
 template<class IntType, class UIntType>
 int tests_set(sycl::queue& queue, int nsamples) {
 
-    constexpr int nparams = 2;
+    constexpr int nparams = 3;
 
-    oneapi::dpl::internal::element_type_t<IntType> left_array [nparams] = {0, -10};
-    oneapi::dpl::internal::element_type_t<IntType> right_array [nparams] = {1000, 10};
+    oneapi::dpl::internal::element_type_t<IntType> left_array [nparams] = {0, -10, -1000000000};
+    oneapi::dpl::internal::element_type_t<IntType> right_array [nparams] = {1000, 10, 1000000000};
 
     // Test for all non-zero parameters
     for(int i = 0; i < nparams; ++i) {
@@ -148,10 +148,10 @@ int tests_set(sycl::queue& queue, int nsamples) {
 template<class IntType, class UIntType>
 int tests_set_portion(sycl::queue& queue, int nsamples, unsigned int part) {
 
-    constexpr int nparams = 2;
+    constexpr int nparams = 3;
 
-    oneapi::dpl::internal::element_type_t<IntType> left_array [nparams] = {0, -10};
-    oneapi::dpl::internal::element_type_t<IntType> right_array [nparams] = {1000, 10};
+    oneapi::dpl::internal::element_type_t<IntType> left_array [nparams] = {0, -10, -1000000000};
+    oneapi::dpl::internal::element_type_t<IntType> right_array [nparams] = {1000, 10, 1000000000};
 
     // Test for all non-zero parameters
     for(int i = 0; i < nparams; ++i) {